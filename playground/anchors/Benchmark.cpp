@@ -0,0 +1,130 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) The authors
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#include "Benchmark.h"
+
+#include <QskAnchorBox.h>
+#include <QskControl.h>
+
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QDebug>
+
+#include <vector>
+
+namespace
+{
+    const int columnCount = 10;
+    const int updateCount = 100;
+
+    class Box : public QskAnchorBox
+    {
+      public:
+        void layout( const QSizeF& size )
+        {
+            setSize( size );
+            updateLayout();
+        }
+    };
+
+    QskControl* createItem()
+    {
+        auto item = new QskControl();
+
+        item->initSizePolicy( QskSizePolicy::Preferred, QskSizePolicy::Preferred );
+
+        item->setMinimumSize( 10, 10 );
+        item->setPreferredSize( 50, 50 );
+        item->setMaximumSize( 500, 500 );
+
+        return item;
+    }
+
+    void populate( Box& box, std::vector< QskControl* >& items, int itemCount )
+    {
+        /*
+            The items are arranged in rows, where each item
+            is anchored to its left and upper neighbours.
+         */
+        for ( int i = 0; i < itemCount; i++ )
+        {
+            auto item = createItem();
+            items.push_back( item );
+
+            const int row = i / columnCount;
+            const int col = i % columnCount;
+
+            if ( col == 0 )
+                box.addAnchor( item, Qt::AnchorLeft, Qt::AnchorLeft );
+            else
+                box.addAnchor( item, Qt::AnchorLeft, items[ i - 1 ], Qt::AnchorRight );
+
+            if ( col == columnCount - 1 || i == itemCount - 1 )
+                box.addAnchor( item, Qt::AnchorRight, Qt::AnchorRight );
+
+            if ( row == 0 )
+                box.addAnchor( item, Qt::AnchorTop, Qt::AnchorTop );
+            else
+                box.addAnchor( item, Qt::AnchorTop, items[ i - columnCount ], Qt::AnchorBottom );
+
+            if ( i + columnCount >= itemCount )
+                box.addAnchor( item, Qt::AnchorBottom, Qt::AnchorBottom );
+        }
+    }
+
+    void runAnchors( int itemCount )
+    {
+        Box box;
+        std::vector< QskControl* > items;
+
+        QElapsedTimer timer;
+        timer.start();
+
+        populate( box, items, itemCount );
+
+        const auto size = box.effectiveSizeHint( Qt::PreferredSize );
+        box.layout( size );
+
+        const auto populateTime = timer.nsecsElapsed();
+
+        timer.restart();
+
+        for ( int i = 0; i < updateCount; i++ )
+            box.layout( size + QSizeF( i, i ) );
+
+        const auto resizeTime = timer.nsecsElapsed() / updateCount;
+
+        timer.restart();
+
+        auto item = items[ itemCount / 2 ];
+
+        for ( int i = 0; i < updateCount; i++ )
+        {
+            item->setPreferredWidth( 50 + i % 2 );
+
+            // the layout request is a posted event
+            QCoreApplication::sendPostedEvents();
+
+            box.layout( box.effectiveSizeHint( Qt::PreferredSize ) );
+        }
+
+        const auto updateTime = timer.nsecsElapsed() / updateCount;
+
+        qDebug().nospace().noquote()
+            << itemCount << " items"
+            << "\tpopulate: " << populateTime / 1000000.0 << "ms"
+            << "\tresize: " << resizeTime / 1000.0 << "us"
+            << "\tupdate: " << updateTime / 1000.0 << "us"
+            << "\t" << size;
+    }
+}
+
+int runBenchmark()
+{
+    for ( const int itemCount : { 100, 200, 400, 800 } )
+        runAnchors( itemCount );
+
+    return 0;
+}
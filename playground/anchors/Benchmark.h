@@ -0,0 +1,15 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) The authors
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#pragma once
+
+/*
+    Measuring QskAnchorBox for a few hundred anchored items:
+
+        - adding the anchors and calculating the preferred size
+        - resizing the box
+        - relayouting after modifying the size hint of a single item
+ */
+int runBenchmark();
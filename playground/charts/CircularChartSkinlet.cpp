@@ -191,15 +191,18 @@ QSGNode* CircularChartSkinlet::updateSampleNode( const QskSkinnable* skinnable,
     return nullptr;
 }
 
-QSGNode* CircularChartSkinlet::updateArcSegmentNode( const QskSkinnable*,
-    QSGNode* node, qreal borderWidth, const QColor& borderColor,
-    const QskGradient& gradient, const QskArcMetrics& metrics ) const
+QSGNode* CircularChartSkinlet::updateArcSegmentNode(
+    const QskSkinnable* skinnable, QSGNode* node, qreal borderWidth,
+    const QColor& borderColor, const QskGradient& gradient,
+    const QskArcMetrics& metrics ) const
 {
     auto arcNode = static_cast< QskArcRenderNode* >( node );
     if ( arcNode == nullptr )
         arcNode = new QskArcRenderNode();
 
-    arcNode->updateArc( m_data->closedArcRect, metrics, true,
+    const auto chart = static_cast< const CircularChart* >( skinnable );
+
+    arcNode->updateArc( chart->window(), m_data->closedArcRect, metrics, true,
         borderWidth, borderColor, gradient );
 
     return arcNode;
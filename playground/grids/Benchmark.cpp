@@ -0,0 +1,76 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) The authors
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#include "Benchmark.h"
+#include "GridSkinny.h"
+#include "GridWidgets.h"
+#include "GridQuick.h"
+
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QtMath>
+#include <QDebug>
+
+#include <cmath>
+
+namespace
+{
+    const int updateCount = 100;
+
+    template< typename Grid >
+    void runGrid( const char* name, int cellCount )
+    {
+        const int columns = qCeil( std::sqrt( cellCount ) );
+
+        Grid grid;
+
+        QElapsedTimer timer;
+        timer.start();
+
+        for ( int i = 0; i < cellCount; i++ )
+            grid.insert( "SkyBlue", i / columns, i % columns, 1, 1 );
+
+        QCoreApplication::sendPostedEvents();
+        const auto size = grid.preferredSize();
+
+        const auto populateTime = timer.nsecsElapsed();
+
+        timer.restart();
+
+        const int index = cellCount / 2;
+
+        for ( int i = 0; i < updateCount; i++ )
+        {
+            grid.setPreferredWidthAt( index, 50 + i % 2 );
+
+            /*
+                Only QGraphicsLayout posts its layout requests, QskGridBox
+                receives them synchronously ( QCoreApplication::sendEvent )
+             */
+            QCoreApplication::sendPostedEvents();
+            ( void ) grid.preferredSize();
+        }
+
+        const auto updateTime = timer.nsecsElapsed() / updateCount;
+
+        qDebug().nospace().noquote()
+            << name << "\t" << cellCount << " cells"
+            << "\tpopulate: " << populateTime / 1000000.0 << "ms"
+            << "\tupdate: " << updateTime / 1000.0 << "us"
+            << "\t" << size;
+    }
+}
+
+int runBenchmark()
+{
+    for ( const int cellCount : { 1000, 2500, 5000, 10000 } )
+    {
+        runGrid< GridSkinny >( "Skinny", cellCount );
+        runGrid< GridWidgets >( "Widgets", cellCount );
+        runGrid< GridQuick >( "Quick", cellCount );
+    }
+
+    return 0;
+}
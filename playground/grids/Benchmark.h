@@ -0,0 +1,16 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) The authors
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#pragma once
+
+/*
+    Measuring the Skinny grid against the Widgets/Quick implementations
+    for grids of 1k - 10k cells:
+
+        - populating the grid and calculating its preferred size
+        - recalculating the preferred size after modifying the
+          size hint of a single cell
+ */
+int runBenchmark();
@@ -4,6 +4,7 @@
  *****************************************************************************/
 
 #include "TestBox.h"
+#include "Benchmark.h"
 
 #include <SkinnyNamespace.h>
 
@@ -390,6 +391,9 @@ int main( int argc, char** argv )
     QApplication app( argc, argv );
     Skinny::init();
 
+    if ( app.arguments().contains( QStringLiteral( "--benchmark" ) ) )
+        return runBenchmark();
+
     int testcase = 0;
     if ( argc == 2 )
         testcase = atoi( argv[1] );
@@ -0,0 +1,117 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) The authors
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#include "Allocations.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+static std::atomic< quint64 > qskAllocationCount { 0 };
+
+static inline void qskCount()
+{
+    qskAllocationCount.fetch_add( 1, std::memory_order_relaxed );
+}
+
+#if defined( __GLIBC__ )
+
+/*
+    The containers of Qt ( QArrayData, QHash ... ) allocate with malloc,
+    so we replace the functions of the C library, that are also used
+    by the default implementation of operator new.
+ */
+extern "C"
+{
+    void* __libc_malloc( size_t );
+    void* __libc_calloc( size_t, size_t );
+    void* __libc_realloc( void*, size_t );
+    void __libc_free( void* );
+
+    void* malloc( size_t size )
+    {
+        qskCount();
+        return __libc_malloc( size );
+    }
+
+    void* calloc( size_t count, size_t size )
+    {
+        qskCount();
+        return __libc_calloc( count, size );
+    }
+
+    void* realloc( void* ptr, size_t size )
+    {
+        qskCount();
+        return __libc_realloc( ptr, size );
+    }
+
+    void free( void* ptr )
+    {
+        __libc_free( ptr );
+    }
+}
+
+const char* Allocations::unit()
+{
+    return "allocations";
+}
+
+#else
+
+static inline void* qskAllocate( std::size_t size )
+{
+    qskCount();
+
+    if ( size == 0 )
+        size = 1;
+
+    if ( auto ptr = std::malloc( size ) )
+        return ptr;
+
+    throw std::bad_alloc();
+}
+
+void* operator new( std::size_t size )
+{
+    return qskAllocate( size );
+}
+
+void* operator new[]( std::size_t size )
+{
+    return qskAllocate( size );
+}
+
+void operator delete( void* ptr ) noexcept
+{
+    std::free( ptr );
+}
+
+void operator delete[]( void* ptr ) noexcept
+{
+    std::free( ptr );
+}
+
+void operator delete( void* ptr, std::size_t ) noexcept
+{
+    std::free( ptr );
+}
+
+void operator delete[]( void* ptr, std::size_t ) noexcept
+{
+    std::free( ptr );
+}
+
+const char* Allocations::unit()
+{
+    return "operator new calls";
+}
+
+#endif
+
+quint64 Allocations::count()
+{
+    return qskAllocationCount.load( std::memory_order_relaxed );
+}
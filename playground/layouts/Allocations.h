@@ -0,0 +1,25 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) The authors
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#pragma once
+
+#include <QtGlobal>
+
+/*
+    Counting the heap allocations of the process. With glibc the functions
+    malloc/calloc/realloc are replaced, so that the allocations of the
+    Qt containers and of operator new are included.
+
+    On other platforms only the calls of the global operator new, that is
+    replaced for this executable, are counted. On Windows this does not
+    even include the allocations inside of the QSkinny and Qt libraries.
+ */
+namespace Allocations
+{
+    quint64 count();
+
+    // what is counted: "allocations" or "operator new calls"
+    const char* unit();
+}
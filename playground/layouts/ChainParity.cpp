@@ -0,0 +1,239 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) The authors
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#include "ChainParity.h"
+
+#include <QskLayoutChain.h>
+
+#include <QRandomGenerator>
+#include <QDebug>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+static QskLayoutChain::Segments qskSegments(
+    const QskLayoutChain& chain, qreal size, bool cached )
+{
+    QskLayoutChain::setStretchingCacheEnabled( cached );
+    const auto segments = chain.segments( size );
+    QskLayoutChain::setStretchingCacheEnabled( true );
+
+    return segments;
+}
+
+static bool qskIsEqual( const QskLayoutChain::Segments& segments1,
+    const QskLayoutChain::Segments& segments2 )
+{
+    if ( segments1.count() != segments2.count() )
+        return false;
+
+    for ( int i = 0; i < segments1.count(); i++ )
+    {
+        // exact comparison by intention
+        if ( segments1[i].start != segments2[i].start
+            || segments1[i].length != segments2[i].length )
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static qreal qskRandomValue( QRandomGenerator& generator, qreal max )
+{
+    // fractional values to provoke rounding errors
+    return generator.bounded( max ) + generator.bounded( 1000 ) / 997.0;
+}
+
+static void qskInitChain( QRandomGenerator& generator, QskLayoutChain& chain )
+{
+    const int count = 1 + generator.bounded( 12 );
+    const bool hasStretches = generator.bounded( 2 );
+
+    chain.setSpacing( generator.bounded( 3 ) * qskRandomValue( generator, 5.0 ) );
+    chain.reset( count, -1 );
+
+    for ( int i = 0; i < count; i++ )
+    {
+        QskLayoutChain::CellData cell;
+        cell.isValid = generator.bounded( 10 ) > 0;
+        cell.canGrow = generator.bounded( 4 ) > 0;
+
+        if ( hasStretches )
+            cell.stretch = generator.bounded( 4 );
+
+        const auto minimum = qskRandomValue( generator, 20.0 );
+        const auto preferred = minimum + qskRandomValue( generator, 100.0 );
+
+        qreal maximum;
+
+        switch( generator.bounded( 5 ) )
+        {
+            case 0:
+                maximum = QskLayoutMetrics::unlimited;
+                break;
+
+            case 1:
+                maximum = preferred;
+                break;
+
+            default:
+                maximum = preferred + qskRandomValue( generator, 300.0 );
+        }
+
+        cell.metrics = QskLayoutMetrics( minimum, preferred, maximum );
+        chain.expandCell( i, cell );
+    }
+
+    chain.finish();
+}
+
+/*
+    The length of a cell is growing with the size of the chain. So we can
+    find the sizes, where a cell stops being bounded to its preferred size
+    or starts being bounded to its maximum, by bisection.
+ */
+template< typename Predicate >
+static qreal qskBoundary( const QskLayoutChain& chain,
+    int index, qreal min, qreal max, Predicate isBeyond )
+{
+    if ( !isBeyond( qskSegments( chain, max, false )[ index ].length ) )
+        return -1.0;
+
+    for ( int i = 0; i < 100; i++ )
+    {
+        const auto size = 0.5 * ( min + max );
+        if ( size <= min || size >= max )
+            break;
+
+        if ( isBeyond( qskSegments( chain, size, false )[ index ].length ) )
+            max = size;
+        else
+            min = size;
+    }
+
+    return max;
+}
+
+static QVector< qreal > qskSizes( QRandomGenerator& generator,
+    const QskLayoutChain& chain )
+{
+    const auto metrics = chain.boundingMetrics();
+
+    const auto min = metrics.preferred();
+
+    auto max = metrics.maximum();
+    if ( max >= QskLayoutMetrics::unlimited )
+        max = min + 5000.0;
+
+    QVector< qreal > boundaries = { min, max };
+
+    for ( int i = 0; i < chain.count(); i++ )
+    {
+        const auto& cell = chain.cell( i );
+        if ( !cell.isValid )
+            continue;
+
+        const auto preferred = cell.metrics.preferred();
+        const auto maximum = cell.metrics.maximum();
+
+        boundaries += qskBoundary( chain, i, min, max,
+            [ preferred ]( qreal length ) { return length > preferred; } );
+
+        if ( maximum < QskLayoutMetrics::unlimited )
+        {
+            boundaries += qskBoundary( chain, i, min, max,
+                [ maximum ]( qreal length ) { return length >= maximum; } );
+        }
+    }
+
+    QVector< qreal > sizes;
+
+    for ( auto boundary : std::as_const( boundaries ) )
+    {
+        if ( boundary < 0.0 )
+            continue;
+
+        sizes += boundary;
+
+        auto below = boundary;
+        auto above = boundary;
+
+        for ( int i = 0; i < 3; i++ )
+        {
+            below = std::nextafter( below, min );
+            above = std::nextafter( above, max );
+
+            sizes += below;
+            sizes += above;
+        }
+
+        // QskLayoutChain keeps a relative margin of 1e-9 to the boundaries
+        for ( const auto f : { 0.5e-9, 1e-9, 2e-9 } )
+        {
+            sizes += boundary * ( 1.0 - f );
+            sizes += boundary * ( 1.0 + f );
+        }
+
+        sizes += boundary - 0.5;
+        sizes += boundary + 0.5;
+    }
+
+    for ( int i = 0; i < 20; i++ )
+        sizes += min + generator.bounded( 1.0 ) * ( max - min );
+
+    // the cache depends on the order of the sizes
+    std::shuffle( sizes.begin(), sizes.end(), generator );
+
+    return sizes;
+}
+
+int ChainParity::check( int chainCount )
+{
+    QRandomGenerator generator( 4711 );
+
+    int sizeCount = 0;
+    int failureCount = 0;
+
+    for ( int i = 0; i < chainCount; i++ )
+    {
+        QskLayoutChain chain;
+        qskInitChain( generator, chain );
+
+        const auto sizes = qskSizes( generator, chain );
+
+        for ( const auto size : sizes )
+        {
+            const auto expected = qskSegments( chain, size, false );
+            const auto segments = qskSegments( chain, size, true );
+
+            if ( !qskIsEqual( segments, expected ) )
+            {
+                if ( failureCount++ < 10 )
+                {
+                    auto debug = qWarning().nospace();
+                    debug << qSetRealNumberPrecision( 17 )
+                        << "chain " << i << ", size " << size << ":";
+
+                    for ( int j = 0; j < qMin( segments.count(), expected.count() ); j++ )
+                    {
+                        debug << "\n\t" << segments[j].start << ", "
+                            << segments[j].length << " <-> " << expected[j].start
+                            << ", " << expected[j].length;
+                    }
+                }
+            }
+        }
+
+        sizeCount += sizes.count();
+    }
+
+    qDebug().nospace() << "chain parity: " << chainCount << " chains, "
+        << sizeCount << " sizes, " << failureCount << " differences";
+
+    return failureCount;
+}
@@ -0,0 +1,21 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) The authors
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#pragma once
+
+/*
+    QskLayoutChain::segments() reuses the solutions for ranges of sizes.
+    The check compares the results with and without this cache for
+    random chains and fails on any difference - not even the last bit
+    of a segment is allowed to differ.
+
+    Most of the sizes are taken from around the boundaries of the ranges,
+    where the floating point calculations of the ranges matter.
+ */
+namespace ChainParity
+{
+    // returns the number of sizes with different segments
+    int check( int chainCount );
+}
@@ -0,0 +1,227 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) The authors
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#include "Scenarios.h"
+
+#include <QskGridBox.h>
+#include <QskLinearBox.h>
+#include <QskPushButton.h>
+#include <QskTextLabel.h>
+
+#include <QRandomGenerator>
+#include <QStringList>
+
+static QskControl* qskCreateLeaf( QQuickItem* parent )
+{
+    auto control = new QskControl( parent );
+
+    control->initSizePolicy( QskSizePolicy::Preferred, QskSizePolicy::Preferred );
+
+    control->setMinimumSize( 10, 10 );
+    control->setPreferredSize( 50, 50 );
+    control->setMaximumSize( 500, 500 );
+
+    return control;
+}
+
+namespace
+{
+    // a linear box with many children
+
+    class WideScenario : public Scenario
+    {
+      public:
+        const char* name() const override { return "wide"; }
+
+        QQuickItem* createTree() override
+        {
+            auto box = new QskLinearBox( Qt::Horizontal );
+
+            for ( int i = 0; i < 1000; i++ )
+            {
+                auto leaf = qskCreateLeaf( box );
+                box->addItem( leaf );
+
+                if ( i == 500 )
+                    m_leaf = leaf;
+            }
+
+            return box;
+        }
+
+        void modify( int step ) override
+        {
+            m_leaf->setPreferredWidth( 50 + step % 2 );
+        }
+
+      private:
+        QskControl* m_leaf = nullptr;
+    };
+
+    // nested boxes, where each modification has to be propagated to the top
+
+    class DeepScenario : public Scenario
+    {
+      public:
+        const char* name() const override { return "deep"; }
+
+        QQuickItem* createTree() override
+        {
+            QskLinearBox* root = nullptr;
+            QskLinearBox* parentBox = nullptr;
+
+            for ( int i = 0; i < 32; i++ )
+            {
+                auto box = new QskLinearBox(
+                    ( i % 2 ) ? Qt::Vertical : Qt::Horizontal );
+
+                if ( parentBox )
+                    parentBox->addItem( box );
+                else
+                    root = box;
+
+                for ( int j = 0; j < 4; j++ )
+                {
+                    m_leaf = qskCreateLeaf( box );
+                    box->addItem( m_leaf );
+                }
+
+                parentBox = box;
+            }
+
+            return root;
+        }
+
+        void modify( int step ) override
+        {
+            m_leaf->setPreferredHeight( 50 + step % 2 );
+        }
+
+      private:
+        QskControl* m_leaf = nullptr;
+    };
+
+    class GridScenario : public Scenario
+    {
+      public:
+        const char* name() const override { return "grid"; }
+
+        QQuickItem* createTree() override
+        {
+            const int dim = 40;
+
+            auto box = new QskGridBox();
+
+            for ( int row = 0; row < dim; row++ )
+            {
+                for ( int col = 0; col < dim; col++ )
+                {
+                    auto leaf = qskCreateLeaf( box );
+
+                    if ( row == col && row == dim / 2 )
+                        m_leaf = leaf;
+
+                    // some cells are spanning over 2 columns
+                    const int columnSpan = ( ( row + col ) % 7 == 0 ) ? 2 : 1;
+                    box->addItem( leaf, row, col, 1, columnSpan );
+                }
+            }
+
+            return box;
+        }
+
+        void modify( int step ) override
+        {
+            m_leaf->setPreferredWidth( 50 + step % 2 );
+        }
+
+      private:
+        QskControl* m_leaf = nullptr;
+    };
+
+    /*
+        Rows of buttons ( QskSubcontrolLayoutEngine ) and word wrapped
+        texts ( heightForWidth constraints )
+     */
+    class TextScenario : public Scenario
+    {
+      public:
+        const char* name() const override { return "text"; }
+
+        QQuickItem* createTree() override
+        {
+            // a fixed seed for getting the same texts for each run
+            QRandomGenerator generator( 42 );
+
+            auto box = new QskLinearBox( Qt::Vertical );
+
+            for ( int i = 0; i < 200; i++ )
+            {
+                auto row = new QskLinearBox( Qt::Horizontal, box );
+
+                auto button = new QskPushButton( QStringLiteral( "Button %1" ).arg( i ), row );
+                button->setSizePolicy( Qt::Horizontal, QskSizePolicy::Fixed );
+
+                auto label = new QskTextLabel( text( generator, 20 + i % 40 ), row );
+                label->setWrapMode( QskTextOptions::WordWrap );
+                label->setSizePolicy( Qt::Horizontal, QskSizePolicy::Preferred );
+
+                row->addItem( button );
+                row->addItem( label );
+
+                if ( i == 100 )
+                {
+                    m_label = label;
+
+                    m_texts[0] = label->text();
+                    m_texts[1] = text( generator, 60 );
+                }
+
+                box->addItem( row );
+            }
+
+            return box;
+        }
+
+        void modify( int step ) override
+        {
+            m_label->setText( m_texts[ step % 2 ] );
+        }
+
+      private:
+        static QString text( QRandomGenerator& generator, int wordCount )
+        {
+            static const char* words[] =
+            {
+                "Lorem", "ipsum", "dolor", "sit", "amet", "consectetur",
+                "adipiscing", "elit", "sed", "do", "eiusmod", "tempor",
+                "incididunt", "ut", "labore", "et", "dolore", "magna", "aliqua"
+            };
+
+            const int count = sizeof( words ) / sizeof( words[0] );
+
+            QStringList list;
+            for ( int i = 0; i < wordCount; i++ )
+                list += QLatin1String( words[ generator.bounded( count ) ] );
+
+            return list.join( QLatin1Char( ' ' ) );
+        }
+
+        QskTextLabel* m_label = nullptr;
+        QString m_texts[2];
+    };
+}
+
+std::vector< std::unique_ptr< Scenario > > createScenarios()
+{
+    std::vector< std::unique_ptr< Scenario > > scenarios;
+
+    scenarios.emplace_back( new WideScenario() );
+    scenarios.emplace_back( new DeepScenario() );
+    scenarios.emplace_back( new GridScenario() );
+    scenarios.emplace_back( new TextScenario() );
+
+    return scenarios;
+}
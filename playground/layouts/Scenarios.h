@@ -0,0 +1,31 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) The authors
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+class QQuickItem;
+
+/*
+    A synthetic tree of items, that is created in the same way
+    for each run, so that the numbers of different builds can
+    be compared.
+ */
+class Scenario
+{
+  public:
+    virtual ~Scenario() = default;
+
+    virtual const char* name() const = 0;
+
+    virtual QQuickItem* createTree() = 0;
+
+    // modifying the size hints of a single item of the tree
+    virtual void modify( int step ) = 0;
+};
+
+std::vector< std::unique_ptr< Scenario > > createScenarios();
@@ -0,0 +1,165 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) The authors
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+/*
+    A headless benchmark for the layout code: QskLinearLayoutEngine,
+    QskGridLayoutEngine, QskLayoutChain and the QskSubcontrolLayoutEngine
+    of the skinlets.
+
+    For each scenario the following operations are measured:
+
+        - create:   creating the tree and calculating its preferred size
+        - layout:   the first layout of the tree
+        - hints:    propagating a modified size hint of a single item
+                    to the preferred size of the tree
+        - relayout: the layout after modifying a single item
+        - resize:   the layout after resizing the tree
+
+    The numbers are the time and the number of heap allocations per operation.
+
+    Before running the benchmark the cached solutions of QskLayoutChain
+    are compared with the plain algorithm. The executable fails, when
+    finding any difference.
+ */
+
+#include "Allocations.h"
+#include "ChainParity.h"
+#include "Scenarios.h"
+
+#include <QskQuick.h>
+#include <QskSizeHintCache.h>
+#include <QskWindow.h>
+
+#include <QGuiApplication>
+#include <QElapsedTimer>
+#include <QDebug>
+
+namespace
+{
+    const int operationCount = 100;
+
+    class Result
+    {
+      public:
+        qint64 nsecs = 0;
+        quint64 allocations = 0;
+    };
+
+    template< typename Operation >
+    Result measure( int count, Operation operation )
+    {
+        const auto allocations = Allocations::count();
+
+        QElapsedTimer timer;
+        timer.start();
+
+        for ( int i = 0; i < count; i++ )
+            operation( i );
+
+        Result result;
+        result.nsecs = timer.nsecsElapsed() / count;
+        result.allocations = ( Allocations::count() - allocations ) / count;
+
+        return result;
+    }
+
+    void report( const char* scenario, const char* operation, const Result& result )
+    {
+        qDebug().nospace().noquote()
+            << scenario << "\t" << operation
+            << "\t" << result.nsecs / 1000.0 << "us"
+            << "\t" << result.allocations << " " << Allocations::unit();
+    }
+
+    void runScenario( QskWindow& window, Scenario& scenario )
+    {
+        const auto name = scenario.name();
+
+        QskSizeHintCache::resetStatistics();
+
+        QQuickItem* root = nullptr;
+        QSizeF size;
+
+        auto create = [&]( int )
+        {
+            root = scenario.createTree();
+            root->setParentItem( window.contentItem() );
+
+            size = qskSizeConstraint( root, Qt::PreferredSize );
+        };
+
+        report( name, "create", measure( 1, create ) );
+
+        auto layout = [&]( int )
+        {
+            root->setSize( size );
+            window.polishItems();
+        };
+
+        report( name, "layout", measure( 1, layout ) );
+
+        auto hints = [&]( int i )
+        {
+            scenario.modify( i );
+            ( void ) qskSizeConstraint( root, Qt::PreferredSize );
+        };
+
+        report( name, "hints", measure( operationCount, hints ) );
+        window.polishItems();
+
+        auto relayout = [&]( int i )
+        {
+            scenario.modify( i );
+            window.polishItems();
+        };
+
+        report( name, "relayout", measure( operationCount, relayout ) );
+
+        // sweeping from 50% to 150% of the preferred width
+        auto resize = [&]( int i )
+        {
+            const qreal f = 0.5 + qreal( i ) / operationCount;
+
+            root->setSize( QSizeF( f * size.width(), size.height() ) );
+            window.polishItems();
+        };
+
+        report( name, "resize", measure( operationCount, resize ) );
+
+        const auto layoutStatistics = window.layoutStatistics();
+        const auto cacheStatistics = QskSizeHintCache::statistics();
+
+        qDebug().nospace().noquote()
+            << name << "\tlast cycle: " << layoutStatistics.polishedItems
+            << " polished items, " << layoutStatistics.measuredHints
+            << " measured hints, cache hit rate: " << cacheStatistics.hitRate();
+
+        delete root;
+    }
+}
+
+int main( int argc, char* argv[] )
+{
+    if ( qEnvironmentVariableIsEmpty( "QT_QPA_PLATFORM" ) )
+        qputenv( "QT_QPA_PLATFORM", "offscreen" );
+
+    QGuiApplication app( argc, argv );
+
+    if ( ChainParity::check( 1000 ) > 0 )
+        return 1;
+
+    /*
+        The window is never shown: the layouts are done
+        by calling polishItems() manually.
+     */
+    QskWindow window;
+    window.setAutoLayoutChildren( false );
+
+    const auto scenarios = createScenarios();
+    for ( const auto& scenario : scenarios )
+        runScenario( window, *scenario );
+
+    return 0;
+}
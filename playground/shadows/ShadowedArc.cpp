@@ -114,7 +114,8 @@ namespace
         const auto borderColor = arc->color( Q::Arc | QskAspect::Border );
         const auto borderWidth = arc->metric( Q::Arc | QskAspect::Border );
 
-        arcNode->setArcData( rect, metrics, borderWidth, borderColor, fillGradient );
+        arcNode->setArcData( arc->window(), rect,
+            metrics, borderWidth, borderColor, fillGradient );
 
         return arcNode;
     }
@@ -0,0 +1,91 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) The authors
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#include "QskPrefixSumIndex.h"
+
+static inline int qskLowBit( int index )
+{
+    return index & -index;
+}
+
+void QskPrefixSumIndex::setValues( const QVector< qreal >& values )
+{
+    m_values = values;
+
+    const int n = values.count();
+
+    m_tree.resize( n + 1 );
+    m_tree[0] = 0.0;
+
+    for ( int i = 1; i <= n; i++ )
+        m_tree[i] = values[i - 1];
+
+    // propagating the partial sums to the parents: O(n)
+    for ( int i = 1; i <= n; i++ )
+    {
+        const int parent = i + qskLowBit( i );
+        if ( parent <= n )
+            m_tree[parent] += m_tree[i];
+    }
+}
+
+void QskPrefixSumIndex::clear()
+{
+    m_values.clear();
+    m_tree.clear();
+}
+
+void QskPrefixSumIndex::setValue( int index, qreal value )
+{
+    if ( index < 0 || index >= m_values.count() )
+        return;
+
+    const auto delta = value - m_values[index];
+    if ( delta == 0.0 )
+        return;
+
+    m_values[index] = value;
+
+    for ( int i = index + 1; i < m_tree.count(); i += qskLowBit( i ) )
+        m_tree[i] += delta;
+}
+
+qreal QskPrefixSumIndex::prefixSum( int index ) const
+{
+    index = qBound( 0, index, m_values.count() );
+
+    qreal sum = 0.0;
+    for ( int i = index; i > 0; i -= qskLowBit( i ) )
+        sum += m_tree[i];
+
+    return sum;
+}
+
+int QskPrefixSumIndex::indexAt( qreal pos ) const
+{
+    if ( pos < 0.0 )
+        return -1;
+
+    const int n = m_values.count();
+
+    int bit = 1;
+    while ( ( bit << 1 ) <= n )
+        bit <<= 1;
+
+    // descending the implicit tree: index = number of values with sum <= pos
+    int index = 0;
+
+    for ( ; bit > 0; bit >>= 1 )
+    {
+        const int next = index + bit;
+        if ( next <= n && m_tree[next] <= pos )
+        {
+            index = next;
+            pos -= m_tree[next];
+        }
+    }
+
+    return index;
+}
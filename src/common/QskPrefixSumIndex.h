@@ -0,0 +1,70 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) The authors
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#ifndef QSK_PREFIX_SUM_INDEX_H
+#define QSK_PREFIX_SUM_INDEX_H
+
+#include "QskGlobal.h"
+#include <qvector.h>
+
+/*
+    A Fenwick tree ( binary indexed tree ) for a sequence of
+    non negative values: f.e the heights of rows.
+
+    Modifying a value, calculating the sum of the leading values
+    ( = the position of a row ) and finding the index for a sum
+    ( = the row at a position ) are O(log n).
+ */
+class QskPrefixSumIndex
+{
+  public:
+    QskPrefixSumIndex() = default;
+
+    // O(n)
+    void setValues( const QVector< qreal >& );
+    void clear();
+
+    int count() const;
+    bool isEmpty() const;
+
+    void setValue( int index, qreal );
+    qreal value( int index ) const;
+
+    // sum of the values [0, index[
+    qreal prefixSum( int index ) const;
+    qreal sum() const;
+
+    /*
+        The index, where prefixSum( index ) <= pos < prefixSum( index + 1 ).
+        Returns -1 for pos < 0 and count() for pos >= sum().
+     */
+    int indexAt( qreal pos ) const;
+
+  private:
+    QVector< qreal > m_values;
+    QVector< qreal > m_tree; // 1 based
+};
+
+inline int QskPrefixSumIndex::count() const
+{
+    return m_values.count();
+}
+
+inline bool QskPrefixSumIndex::isEmpty() const
+{
+    return m_values.isEmpty();
+}
+
+inline qreal QskPrefixSumIndex::value( int index ) const
+{
+    return m_values[ index ];
+}
+
+inline qreal QskPrefixSumIndex::sum() const
+{
+    return prefixSum( m_values.count() );
+}
+
+#endif
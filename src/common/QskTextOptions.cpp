@@ -68,6 +68,7 @@ QskHashValue QskTextOptions::hash( QskHashValue seed ) const noexcept
     hash = qHash( m_wrapMode, hash );
     hash = qHash( m_format, hash );
     hash = qHash( m_elideMode, hash );
+    hash = qHash( m_renderType, hash );
 
     return hash;
 }
@@ -83,7 +84,8 @@ QDebug operator<<( QDebug debug, const QskTextOptions& options )
     debug << "TextOptions" << '(';
     debug << options.format() << "," << options.elideMode()
           << options.fontSizeMode() << options.wrapMode()
-          << "," << options.maximumLineCount();
+          << "," << options.maximumLineCount()
+          << "," << options.renderType();
     debug << ')';
     return debug;
 }
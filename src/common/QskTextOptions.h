@@ -22,6 +22,7 @@ class QSK_EXPORT QskTextOptions
     Q_PROPERTY( WrapMode wrapMode READ wrapMode WRITE setWrapMode )
     Q_PROPERTY( FontSizeMode fontSizeMode READ fontSizeMode WRITE setFontSizeMode )
     Q_PROPERTY( int maximumLineCount READ maximumLineCount WRITE setMaximumLineCount )
+    Q_PROPERTY( RenderType renderType READ renderType WRITE setRenderType )
 
   public:
     enum FontSizeMode : quint8
@@ -52,6 +53,25 @@ class QSK_EXPORT QskTextOptions
     };
     Q_ENUM( TextFormat )
 
+    enum RenderType : quint8
+    {
+        // QQuickWindow::textRenderType()
+        DefaultRendering,
+
+        /*
+            Glyphs from a distance field cache, that can be scaled
+            without rasterizing them again: f.e for animated font sizes
+         */
+        DistanceFieldRendering,
+
+        // rasterized by the platform for the exact pixel size
+        NativeRendering,
+
+        // Qt >= 6.7, falling back to DistanceFieldRendering otherwise
+        CurveRendering
+    };
+    Q_ENUM( RenderType )
+
     constexpr QskTextOptions() noexcept;
 
     constexpr TextFormat format() const noexcept;
@@ -73,6 +93,9 @@ class QSK_EXPORT QskTextOptions
     constexpr int maximumLineCount() const noexcept;
     void setMaximumLineCount( int ) noexcept;
 
+    constexpr RenderType renderType() const noexcept;
+    void setRenderType( RenderType ) noexcept;
+
     constexpr bool operator==( const QskTextOptions& other ) const noexcept;
     constexpr bool operator!=( const QskTextOptions& other ) const noexcept;
 
@@ -86,6 +109,7 @@ class QSK_EXPORT QskTextOptions
     WrapMode m_wrapMode : 4;
     TextFormat m_format : 3;
     unsigned int m_elideMode : 2;
+    RenderType m_renderType : 2;
 };
 
 inline constexpr QskTextOptions::QskTextOptions() noexcept
@@ -94,6 +118,7 @@ inline constexpr QskTextOptions::QskTextOptions() noexcept
     , m_wrapMode( QskTextOptions::NoWrap )
     , m_format( PlainText ) // AutoText ???
     , m_elideMode( Qt::ElideNone )
+    , m_renderType( DefaultRendering )
 {
 }
 
@@ -153,6 +178,16 @@ constexpr inline int QskTextOptions::maximumLineCount() const noexcept
     return m_maximumLineCount;
 }
 
+inline void QskTextOptions::setRenderType( RenderType renderType ) noexcept
+{
+    m_renderType = renderType;
+}
+
+constexpr inline QskTextOptions::RenderType QskTextOptions::renderType() const noexcept
+{
+    return m_renderType;
+}
+
 inline constexpr bool QskTextOptions::operator==(
     const QskTextOptions& other ) const noexcept
 {
@@ -160,7 +195,8 @@ inline constexpr bool QskTextOptions::operator==(
            ( m_elideMode == other.m_elideMode ) &&
            ( m_wrapMode == other.m_wrapMode ) &&
            ( m_fontSizeMode == other.m_fontSizeMode ) &&
-           ( m_maximumLineCount == other.m_maximumLineCount );
+           ( m_maximumLineCount == other.m_maximumLineCount ) &&
+           ( m_renderType == other.m_renderType );
 }
 
 inline constexpr bool QskTextOptions::operator!=(
@@ -11,6 +11,7 @@
 #include "QskTextOptions.h"
 
 #include "QskSGNode.h"
+#include "QskSubcontrolLayoutCache.h"
 #include "QskSubcontrolLayoutEngine.h"
 #include "QskTextRenderer.h"
 
@@ -108,10 +109,12 @@ QRectF QskComboBoxSkinlet::subControlRect( const QskSkinnable* skinnable,
     {
         const auto r = box->subControlContentsRect( contentsRect, Q::Panel );
 
-        LayoutEngine layoutEngine( box );
-        layoutEngine.setGeometries( r );
-
-        return layoutEngine.subControlRect( subControl );
+        /*
+            Changing the current index does not reset the implicit size,
+            so it has to be part of the key
+         */
+        return qskSubcontrolLayoutRect< LayoutEngine >(
+            box, r, box->currentIndex(), subControl, box );
     }
 
     if( subControl == Q::StatusIndicator )
@@ -600,7 +600,7 @@ QSizeF QskControl::implicitSizeHint(
     }
     else
     {
-        hint = d_func()->implicitSizeHint( whichHint, constraint );
+        hint = d_func()->cachedImplicitSizeHint( whichHint, constraint );
     }
 
     return hint;
@@ -9,6 +9,8 @@
 #include "QskObjectTree.h"
 #include "QskWindow.h"
 #include "QskEvent.h"
+#include "QskSizeHintCache.h"
+#include "QskSubcontrolLayoutCache.h"
 
 static inline void qskSendEventTo( QObject* object, QEvent::Type type )
 {
@@ -147,6 +149,8 @@ static QskAspect::Section qskInheritedSection( const QskControl* control )
 
 QskControlPrivate::QskControlPrivate()
     : explicitSizeHints( nullptr )
+    , sizeHintCache( nullptr )
+    , layoutCache( nullptr )
     , sizePolicy( QskSizePolicy::Preferred, QskSizePolicy::Preferred )
     , visiblePlacementPolicy( 0 )
     , hiddenPlacementPolicy( 0 )
@@ -161,10 +165,18 @@ QskControlPrivate::QskControlPrivate()
 QskControlPrivate::~QskControlPrivate()
 {
     delete [] explicitSizeHints;
+    delete sizeHintCache;
+    delete layoutCache;
 }
 
 void QskControlPrivate::layoutConstraintChanged()
 {
+    /*
+        Called from resetImplicitSize ( QskItem::DeferredLayout ),
+        when the hints have to be recalculated
+     */
+    clearSizeHintCache();
+
     if ( !blockLayoutRequestEvents )
     {
         Inherited::layoutConstraintChanged();
@@ -188,6 +200,9 @@ void QskControlPrivate::implicitSizeChanged()
 
 QSizeF QskControlPrivate::implicitSizeHint() const
 {
+    // recalculating the implicit size: all other hints are outdated as well
+    const_cast< QskControlPrivate* >( this )->clearSizeHintCache();
+
     return implicitSizeHint( Qt::PreferredSize, QSizeF() );
 }
 
@@ -280,6 +295,40 @@ QSizeF QskControlPrivate::implicitSizeHint(
     return QSizeF( w, h );
 }
 
+QSizeF QskControlPrivate::cachedImplicitSizeHint(
+    Qt::SizeHint which, const QSizeF& constraint ) const
+{
+    /*
+        The layout engines ask for the same constrained hints
+        several times during a layout pass and again for
+        the following ones. As calculating them usually involves
+        the skinlet ( f.e measuring texts ), we cache them until
+        the next resetImplicitSize.
+     */
+    if ( sizeHintCache == nullptr )
+        sizeHintCache = new QskSizeHintCache();
+
+    QSizeF hint;
+
+    if ( !sizeHintCache->find( which, constraint, hint ) )
+    {
+        hint = implicitSizeHint( which, constraint );
+        sizeHintCache->insert( which, constraint, hint );
+    }
+
+    return hint;
+}
+
+void QskControlPrivate::clearSizeHintCache()
+{
+    if ( sizeHintCache )
+        sizeHintCache->clear();
+
+    // what affects the size hints usually affects the subcontrols as well
+    if ( layoutCache )
+        layoutCache->clear();
+}
+
 void QskControlPrivate::setExplicitSizeHint(
     Qt::SizeHint whichHint, const QSizeF& size )
 {
@@ -362,6 +411,18 @@ void QskControlPrivate::resolveSection( QskControl* control )
     }
 }
 
+QskSubcontrolLayoutCache* QskControlPrivate::subcontrolLayoutCache(
+    const QskControl* control, bool create )
+{
+    auto d = static_cast< const QskControlPrivate* >(
+        QQuickItemPrivate::get( const_cast< QskControl* >( control ) ) );
+
+    if ( d->layoutCache == nullptr && create )
+        d->layoutCache = new QskSubcontrolLayoutCache();
+
+    return d->layoutCache;
+}
+
 void QskControlPrivate::setPlacementPolicy(
     bool visible, QskPlacementPolicy::Policy policy )
 {
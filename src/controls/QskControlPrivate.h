@@ -10,6 +10,9 @@
 #include "QskControl.h"
 #include "QskItemPrivate.h"
 
+class QskSizeHintCache;
+class QskSubcontrolLayoutCache;
+
 class QskControlPrivate : public QskItemPrivate
 {
     using Inherited = QskItemPrivate;
@@ -21,6 +24,9 @@ class QskControlPrivate : public QskItemPrivate
     static bool inheritSection( QskControl*, QskAspect::Section );
     static void resolveSection( QskControl* );
 
+    static QskSubcontrolLayoutCache* subcontrolLayoutCache(
+        const QskControl*, bool create = true );
+
   protected:
     QskControlPrivate();
     ~QskControlPrivate() override;
@@ -33,6 +39,9 @@ class QskControlPrivate : public QskItemPrivate
     QSizeF implicitSizeHint( Qt::SizeHint, const QSizeF& ) const;
     QSizeF implicitSizeHint() const override final;
 
+    QSizeF cachedImplicitSizeHint( Qt::SizeHint, const QSizeF& ) const;
+    void clearSizeHintCache();
+
     void implicitSizeChanged() override final;
     void layoutConstraintChanged() override final;
 
@@ -44,6 +53,12 @@ class QskControlPrivate : public QskItemPrivate
 
     QSizeF* explicitSizeHints;
 
+    // constrained/minimum/maximum hints, allocated on demand
+    mutable QskSizeHintCache* sizeHintCache;
+
+    // rectangles of the subcontrols, allocated on demand
+    mutable QskSubcontrolLayoutCache* layoutCache;
+
     QLocale locale;
 
     QskSizePolicy sizePolicy;
@@ -40,6 +40,8 @@ QSK_QT_PRIVATE_END
 
 #include <unordered_set>
 
+extern bool qskAboutToPolish( QQuickItem* );
+
 static inline void qskSendEventTo( QObject* object, QEvent::Type type )
 {
     QEvent event( type );
@@ -1072,6 +1074,9 @@ void QskItem::updatePolish()
 {
     Q_D( QskItem );
 
+    if ( !qskAboutToPolish( this ) )
+        return; // polished again, after the items above
+
     if ( d->updateFlags & QskItem::DeferredPolish )
     {
         if ( !isVisible() )
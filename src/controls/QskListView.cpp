@@ -8,6 +8,7 @@
 #include "QskColorFilter.h"
 #include "QskEvent.h"
 #include "QskSkinlet.h"
+#include "QskPrefixSumIndex.h"
 
 #include <qguiapplication.h>
 #include <qstylehints.h>
@@ -29,7 +30,7 @@ static inline int qskRowAt( const QskListView* listView, const QPointF& pos )
     {
         const auto y = pos.y() - rect.top() + listView->scrollPos().y();
 
-        const int row = y / listView->rowHeight();
+        const int row = listView->rowAt( y );
         if ( row >= 0 && row < listView->rowCount() )
             return row;
     }
@@ -42,10 +43,48 @@ class QskListView::PrivateData
   public:
     PrivateData()
         : preferredWidthFromColumns( false )
+        , variableRowHeights( false )
+        , textBatching( false )
         , selectionMode( QskListView::SingleSelection )
     {
     }
 
+    const QskPrefixSumIndex& rowIndex( const QskListView* listView )
+    {
+        const int count = listView->rowCount();
+
+        if ( rowIndexDirty || rowHeights.count() != count )
+        {
+            QVector< qreal > heights;
+            heights.reserve( count );
+
+            for ( int row = 0; row < count; row++ )
+                heights += qMax( listView->rowHeightAt( row ), 0.0 );
+
+            rowHeights.setValues( heights );
+            rowIndexDirty = false;
+        }
+
+        return rowHeights;
+    }
+
+    void addRowsChange( int first, int last )
+    {
+        contentsRevision++;
+
+        /*
+            Only the most recent modifications are stored. A skinlet, that
+            has seen an older revision, has to refresh all rows.
+         */
+        if ( rowsChanges.count() >= 32 )
+        {
+            resetRevision = rowsChanges.first().revision;
+            rowsChanges.removeFirst();
+        }
+
+        rowsChanges += RowsChange{ contentsRevision, first, last };
+    }
+
     void setRowState( QskListView* listView, int row, QskAspect::State state )
     {
         using Q = QskListView;
@@ -90,11 +129,28 @@ class QskListView::PrivateData
      */
 
     bool preferredWidthFromColumns : 1;
+    bool variableRowHeights : 1;
+    bool textBatching : 1;
     SelectionMode selectionMode : 4;
 
     int hoveredRow = -1;
     int pressedRow = -1;
     int selectedRow = -1;
+
+    quint64 contentsRevision = 0;
+    quint64 resetRevision = 0;
+
+    struct RowsChange
+    {
+        quint64 revision;
+        int first;
+        int last;
+    };
+
+    QVector< RowsChange > rowsChanges;
+
+    QskPrefixSumIndex rowHeights;
+    bool rowIndexDirty = true;
 };
 
 QskListView::QskListView( QQuickItem* parent )
@@ -281,7 +337,7 @@ void QskListView::keyPressEvent( QKeyEvent* event )
     {
         auto pos = scrollPos();
 
-        const qreal rowPos = row * rowHeight();
+        const qreal rowPos = rowPosition( row );
         if ( rowPos < scrollPos().y() )
         {
             pos.setY( rowPos );
@@ -291,9 +347,9 @@ void QskListView::keyPressEvent( QKeyEvent* event )
             const QRectF vr = viewContentsRect();
 
             const double scrolledBottom = scrollPos().y() + vr.height();
-            if ( rowPos + rowHeight() > scrolledBottom )
+            if ( rowPos + rowHeightAt( row ) > scrolledBottom )
             {
-                const double y = rowPos + rowHeight() - vr.height();
+                const double y = rowPos + rowHeightAt( row ) - vr.height();
                 pos.setY( y );
             }
         }
@@ -398,19 +454,23 @@ QskAspect::States QskListView::rowStates( int row ) const
 
 #ifndef QT_NO_WHEELEVENT
 
-static qreal qskAlignedToRows( const qreal y0, qreal dy,
-    qreal rowHeight, qreal viewHeight )
+static qreal qskAlignedToRows( const QskListView* listView,
+    const qreal y0, qreal dy, qreal viewHeight )
 {
     qreal y = y0 - dy;
 
     if ( dy > 0 )
     {
-        y = qFloor( y / rowHeight ) * rowHeight;
+        y = listView->rowPosition( listView->rowAt( y ) );
     }
     else
     {
         y += viewHeight;
-        y = qCeil( y / rowHeight ) * rowHeight;
+
+        const int row = listView->rowAt( y );
+        if ( listView->rowPosition( row ) < y )
+            y = listView->rowPosition( row + 1 );
+
         y -= viewHeight;
     }
 
@@ -457,7 +517,7 @@ QPointF QskListView::scrollOffset( const QWheelEvent* event ) const
         dy *= offset.y(); // multiplied by the wheelsteps
 
         // aligning rows that enter the view
-        dy = qskAlignedToRows( y0, dy, rowHeight, viewHeight );
+        dy = qskAlignedToRows( this, y0, dy, viewHeight );
 
         offset.setY( y0 - dy );
     }
@@ -471,7 +531,7 @@ QPointF QskListView::scrollOffset( const QWheelEvent* event ) const
 
 void QskListView::updateScrollableSize()
 {
-    const double h = rowCount() * rowHeight();
+    const double h = rowPosition( rowCount() );
 
     qreal w = 0.0;
     for ( int col = 0; col < columnCount(); col++ )
@@ -488,6 +548,121 @@ void QskListView::updateScrollableSize()
     }
 }
 
+void QskListView::invalidateContents()
+{
+    m_data->contentsRevision++;
+
+    m_data->resetRevision = m_data->contentsRevision;
+    m_data->rowsChanges.clear();
+    m_data->rowIndexDirty = true;
+
+    update();
+}
+
+void QskListView::rowsChanged( int first, int last )
+{
+    first = qMax( first, 0 );
+    last = qMin( last, rowCount() - 1 );
+
+    if ( last < first )
+        return;
+
+    m_data->addRowsChange( first, last );
+
+    if ( m_data->variableRowHeights && !m_data->rowIndexDirty )
+    {
+        auto& rowHeights = m_data->rowHeights;
+
+        const auto oldHeight = rowHeights.sum();
+
+        for ( int row = first; row <= last; row++ )
+            rowHeights.setValue( row, qMax( rowHeightAt( row ), 0.0 ) );
+
+        if ( rowHeights.sum() != oldHeight )
+            updateScrollableSize();
+    }
+
+    update();
+}
+
+quint64 QskListView::contentsRevision() const
+{
+    return m_data->contentsRevision;
+}
+
+bool QskListView::isRowChanged( int row, quint64 revision ) const
+{
+    if ( revision == 0 || revision < m_data->resetRevision )
+        return true;
+
+    const auto& changes = m_data->rowsChanges;
+
+    for ( auto it = changes.crbegin(); it != changes.crend(); ++it )
+    {
+        if ( it->revision <= revision )
+            break;
+
+        if ( row >= it->first && row <= it->last )
+            return true;
+    }
+
+    return false;
+}
+
+void QskListView::setVariableRowHeights( bool on )
+{
+    if ( on != m_data->variableRowHeights )
+    {
+        m_data->variableRowHeights = on;
+        m_data->rowIndexDirty = true;
+        m_data->rowHeights.clear();
+
+        updateScrollableSize();
+        update();
+    }
+}
+
+bool QskListView::hasVariableRowHeights() const
+{
+    return m_data->variableRowHeights;
+}
+
+void QskListView::setTextBatching( bool on )
+{
+    if ( on != m_data->textBatching )
+    {
+        m_data->textBatching = on;
+        update();
+    }
+}
+
+bool QskListView::hasTextBatching() const
+{
+    return m_data->textBatching;
+}
+
+qreal QskListView::rowHeightAt( int row ) const
+{
+    Q_UNUSED( row );
+    return rowHeight();
+}
+
+qreal QskListView::rowPosition( int row ) const
+{
+    if ( m_data->variableRowHeights )
+        return m_data->rowIndex( this ).prefixSum( row );
+
+    return row * rowHeight();
+}
+
+int QskListView::rowAt( qreal y ) const
+{
+    if ( m_data->variableRowHeights )
+        return m_data->rowIndex( this ).indexAt( y );
+
+    return qFloor( y / rowHeight() );
+}
+
 void QskListView::componentComplete()
 {
     Inherited::componentComplete();
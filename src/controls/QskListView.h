@@ -64,6 +64,44 @@ class QSK_EXPORT QskListView : public QskScrollView
 
     Q_INVOKABLE virtual QVariant valueAt( int row, int col ) const = 0;
 
+    /*
+        The revision is increased by invalidateContents() and rowsChanged().
+        The skinlet reuses the values of rows, that have already been on
+        screen and have not been changed, instead of calling valueAt again.
+        0 means, that the subclass does not track its modifications.
+     */
+    quint64 contentsRevision() const;
+
+    // true, when the row has been modified after revision
+    bool isRowChanged( int row, quint64 revision ) const;
+
+    /*
+        By default all rows have the same height: rowHeight(). With variable
+        row heights rowHeightAt() is called for each row and the positions
+        are looked up from a prefix sum index in O(log n). Modified heights
+        have to be announced by rowsChanged(), inserted/removed rows by
+        invalidateContents().
+     */
+    void setVariableRowHeights( bool );
+    bool hasVariableRowHeights() const;
+
+    virtual qreal rowHeightAt( int row ) const;
+
+    /*
+        When enabled, the texts of all cells are rendered by one
+        QskBatchedTextNode, as long as all values are plain texts.
+        Less nodes, but any change requires to rebuild the glyphs
+        of all visible cells.
+     */
+    void setTextBatching( bool );
+    bool hasTextBatching() const;
+
+    // y coordinate of the top of a row, relative to the first row
+    qreal rowPosition( int row ) const;
+
+    // the row at y, not bounded to [ 0, rowCount() [
+    int rowAt( qreal y ) const;
+
     QRectF focusIndicatorRect() const override;
 
   public Q_SLOTS:
@@ -95,6 +133,8 @@ class QSK_EXPORT QskListView : public QskScrollView
 #endif
 
     void updateScrollableSize();
+    void invalidateContents();
+    void rowsChanged( int first, int last );
 
     void componentComplete() override;
 
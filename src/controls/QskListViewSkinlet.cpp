@@ -9,6 +9,8 @@
 #include "QskColorFilter.h"
 #include "QskGraphic.h"
 #include "QskBoxHints.h"
+#include "QskBatchedTextNode.h"
+#include "QskInstancedBoxNode.h"
 #include "QskSGNode.h"
 #include "QskSkinStateChanger.h"
 #include "QskQuick.h"
@@ -25,15 +27,19 @@ namespace
         void invalidate()
         {
             removeAllChildNodes();
-            m_columnCount = m_oldRowMin = m_oldRowMax = -1;
+
+            m_oldRowMin = m_oldRowMax = -1;
+            m_oldColumnMin = m_oldColumnMax = -1;
+
+            m_values.clear();
         }
 
-        void rearrangeNodes( int rowMin, int rowMax, int columnCount )
+        void rearrangeNodes( const QskListView* listView,
+            int rowMin, int rowMax, int columnMin, int columnMax )
         {
-            const bool doReorder = ( columnCount == m_columnCount )
-                && ( rowMin <= m_oldRowMax ) && ( rowMax >= m_oldRowMin );
+            const int columnCount = columnMax - columnMin + 1;
 
-            if ( doReorder )
+            if ( isOverlapping( rowMin, rowMax, columnMin, columnMax ) )
             {
                 /*
                     We have nodes that will be at a different position in the
@@ -75,12 +81,73 @@ namespace
                 }
             }
 
+            rearrangeValues( listView, rowMin, rowMax, columnMin, columnMax );
+        }
+
+        void rearrangeValues( const QskListView* listView,
+            int rowMin, int rowMax, int columnMin, int columnMax )
+        {
+            /*
+                Values of rows, that have already been on screen, can be
+                reused as long as the row has not been changed.
+                This way valueAt is only called for the rows, that are
+                exposed by scrolling or have been modified.
+             */
+            const auto revision = listView->contentsRevision();
+            const int columnCount = columnMax - columnMin + 1;
+
+            QVector< QVariant > values( qMax( rowMax - rowMin + 1, 0 ) * columnCount );
+
+            if ( revision != 0 && isOverlapping( rowMin, rowMax, columnMin, columnMax ) )
+            {
+                const int from = qMax( rowMin, m_oldRowMin );
+                const int to = qMin( rowMax, m_oldRowMax );
+
+                for ( int row = from; row <= to; row++ )
+                {
+                    if ( listView->isRowChanged( row, m_revision ) )
+                        continue;
+
+                    const auto oldIndex = ( row - m_oldRowMin ) * columnCount;
+                    const auto index = ( row - rowMin ) * columnCount;
+
+                    for ( int col = 0; col < columnCount; col++ )
+                        values[ index + col ] = m_values[ oldIndex + col ];
+                }
+            }
+
+            m_values = values;
+
             m_oldRowMin = rowMin;
             m_oldRowMax = rowMax;
-            m_columnCount = columnCount;
+            m_oldColumnMin = columnMin;
+            m_oldColumnMax = columnMax;
+            m_revision = revision;
+        }
+
+        QVariant valueAt( const QskListView* listView, int row, int col )
+        {
+            const int columnCount = m_oldColumnMax - m_oldColumnMin + 1;
+            const int index = ( row - m_oldRowMin ) * columnCount + ( col - m_oldColumnMin );
+
+            if ( index < 0 || index >= m_values.count() )
+                return listView->valueAt( row, col );
+
+            auto& value = m_values[ index ];
+            if ( !value.isValid() )
+                value = listView->valueAt( row, col );
+
+            return value;
         }
 
       private:
+        inline bool isOverlapping( int rowMin, int rowMax,
+            int columnMin, int columnMax ) const
+        {
+            return ( columnMin == m_oldColumnMin ) && ( columnMax == m_oldColumnMax )
+                && ( rowMin <= m_oldRowMax ) && ( rowMax >= m_oldRowMin );
+        }
+
         /*
             When scrolling the majority of the child nodes are simply translated
             while only few rows appear/disappear. To implement this in an efficient
@@ -89,7 +156,12 @@ namespace
 
         int m_oldRowMin = -1;
         int m_oldRowMax = -1;
-        int m_columnCount = -1;
+
+        int m_oldColumnMin = -1;
+        int m_oldColumnMax = -1;
+
+        quint64 m_revision = 0;
+        QVector< QVariant > m_values;
     };
 
     class ListViewNode final : public QSGTransformNode
@@ -110,15 +182,41 @@ namespace
             setMatrix( QTransform::fromTranslate( -scrollPos.x(), -scrollPos.y() ) );
 
             m_clipRect = listView->viewContentsRect();
-            m_rowHeight = listView->rowHeight();
 
-            m_rowMin = qFloor( scrollPos.y() / m_rowHeight );
-
-            const auto rowMax = ( scrollPos.y() + m_clipRect.height() ) / m_rowHeight;
-            m_rowMax = qFloor( rowMax - 10e-6 );
+            m_rowMin = qMax( listView->rowAt( scrollPos.y() ), 0 );
 
+            m_rowMax = listView->rowAt( scrollPos.y() + m_clipRect.height() - 10e-6 );
             if ( m_rowMax >= listView->rowCount() )
                 m_rowMax = listView->rowCount() - 1;
+
+            // the columns intersecting the clip rectangle
+
+            const auto x1 = scrollPos.x();
+            const auto x2 = x1 + m_clipRect.width();
+
+            m_columnMin = 0;
+            m_columnMax = -1;
+            m_columnX = 0.0;
+
+            qreal x = 0.0;
+
+            for ( int col = 0; col < listView->columnCount() && x < x2; col++ )
+            {
+                const auto w = listView->columnWidth( col );
+
+                if ( x + w > x1 )
+                {
+                    if ( m_columnMax < 0 )
+                    {
+                        m_columnMin = col;
+                        m_columnX = x;
+                    }
+
+                    m_columnMax = col;
+                }
+
+                x += w;
+            }
         }
 
         QRectF clipRect() const { return m_clipRect; }
@@ -127,7 +225,12 @@ namespace
         int rowMax() const { return m_rowMax; }
         int rowCount() const { return m_rowMax - m_rowMin + 1; }
 
-        int rowHeight() const { return m_rowHeight; }
+        int columnMin() const { return m_columnMin; }
+        int columnMax() const { return m_columnMax; }
+        int columnCount() const { return m_columnMax - m_columnMin + 1; }
+
+        // position of columnMin(), relative to the left of the clip rectangle
+        qreal columnX() const { return m_columnX; }
 
         QSGNode* backgroundNode() { return &m_backgroundNode; }
         ForegroundNode* foregroundNode() { return &m_foregroundNode; }
@@ -136,10 +239,12 @@ namespace
         // caching some calculations to speed things up
 
         QRectF m_clipRect;
-        qreal m_rowHeight;
 
         int m_rowMin, m_rowMax;
 
+        int m_columnMin, m_columnMax;
+        qreal m_columnX;
+
         QSGNode m_backgroundNode;
         ForegroundNode m_foregroundNode;
     };
@@ -166,6 +271,19 @@ static inline ListViewNode* qskListViewNode( const QskListView* listView )
     return nullptr;
 }
 
+static inline QColor qskTextColor(
+    const QskSkinnable* skinnable, QskAspect::Subcontrol subControl )
+{
+    // see QskSkinlet::updateTextNode
+    QskSkinHintStatus status;
+
+    auto textColor = skinnable->color( subControl, &status );
+    if ( !status.isValid() )
+        textColor = skinnable->color( subControl | QskAspect::TextColor );
+
+    return textColor;
+}
+
 QskListViewSkinlet::QskListViewSkinlet( QskSkin* skin )
     : Inherited( skin )
 {
@@ -191,11 +309,61 @@ void QskListViewSkinlet::updateBackgroundNodes(
     const QskListView* listView, QSGNode* backgroundNode ) const
 {
     using Q = QskListView;
+    using namespace QskSGNode;
 
     auto listViewNode = static_cast< const ListViewNode* >( backgroundNode->parent() );
 
+    /*
+        Usually the cells differ in their colors only and we can render all
+        of them with one QskInstancedBoxNode. Only when having gradients or
+        shadows we need to fall back to a QskBoxNode for each row.
+     */
+
+    QVector< QskInstancedBoxNode::Instance > instances;
+    instances.reserve( listViewNode->rowCount() );
+
+    for ( int row = listViewNode->rowMin(); row <= listViewNode->rowMax(); row++ )
+    {
+        QskSkinStateChanger stateChanger( listView );
+        stateChanger.setStates( sampleStates( listView, Q::Cell, row ), row );
+
+        const auto boxHints = listView->boxHints( Q::Cell );
+        if ( !QskInstancedBoxNode::isInstantiable( boxHints ) )
+        {
+            instances.clear();
+            break;
+        }
+
+        auto rect = sampleRect( listView, listView->contentsRect(), Q::Cell, row );
+        rect = rect.marginsRemoved( listView->marginHint( Q::Cell ) );
+
+        instances += QskInstancedBoxNode::Instance( rect, boxHints );
+    }
+
     auto rowNode = backgroundNode->firstChild();
 
+    if ( !instances.isEmpty() )
+    {
+        auto boxesNode = static_cast< QskInstancedBoxNode* >( rowNode );
+
+        if ( nodeRole( rowNode ) != CellRole )
+        {
+            removeAllChildNodesFrom( backgroundNode, rowNode );
+
+            boxesNode = appendChildNode< QskInstancedBoxNode >(
+                backgroundNode, CellRole );
+        }
+
+        boxesNode->updateNode( listView->window(), instances );
+        return;
+    }
+
+    if ( nodeRole( rowNode ) == CellRole )
+    {
+        removeAllChildNodesFrom( backgroundNode, rowNode );
+        rowNode = nullptr;
+    }
+
     for ( int row = listViewNode->rowMin(); row <= listViewNode->rowMax(); row++ )
     {
         QskSkinStateChanger stateChanger( listView );
@@ -213,49 +381,53 @@ void QskListViewSkinlet::updateBackgroundNodes(
         }
     }
 
-    QskSGNode::removeAllChildNodesFrom( backgroundNode, rowNode );
+    removeAllChildNodesFrom( backgroundNode, rowNode );
 }
 
 void QskListViewSkinlet::updateForegroundNodes(
     const QskListView* listView, QSGNode* parentNode ) const
 {
     auto foregroundNode = static_cast< ForegroundNode* >( parentNode );
+    auto listViewNode = static_cast< const ListViewNode* >( parentNode->parent() );
 
-    if ( listView->rowCount() <= 0 || listView->columnCount() <= 0 )
+    if ( listViewNode->rowCount() <= 0 || listViewNode->columnCount() <= 0 )
     {
         foregroundNode->invalidate();
         return;
     }
 
-    auto listViewNode = static_cast< const ListViewNode* >( parentNode->parent() );
+    if ( listView->hasTextBatching() )
+    {
+        if ( updateBatchedForegroundNode( listView, foregroundNode ) )
+            return;
+    }
+
+    if ( QskSGNode::nodeRole( foregroundNode->firstChild() ) == TextBatchRole )
+        foregroundNode->invalidate();
 
     const auto clipRect = listViewNode->clipRect();
 
     const int rowMin = listViewNode->rowMin();
     const int rowMax = listViewNode->rowMax();
 
-    foregroundNode->rearrangeNodes( rowMin, rowMax, listView->columnCount() );
+    const int colMin = listViewNode->columnMin();
+    const int colMax = listViewNode->columnMax();
 
-#if 1
-    // should be optimized for visible columns only
-    const int colMin = 0;
-    const int colMax = listView->columnCount() - 1;
-#endif
+    foregroundNode->rearrangeNodes( listView, rowMin, rowMax, colMin, colMax );
 
     const auto margins = listView->paddingHint( QskListView::Cell );
 
-    updateVisibleForegroundNodes(
-        listView, foregroundNode, rowMin, rowMax, margins );
+    updateVisibleForegroundNodes( listView, foregroundNode,
+        rowMin, rowMax, colMin, colMax, margins );
 
     // finally putting the nodes into their position
     auto node = foregroundNode->firstChild();
 
-    const auto rowHeight = listView->rowHeight();
-    auto y = clipRect.top() + rowMin * rowHeight;
+    auto y = clipRect.top() + listView->rowPosition( rowMin );
 
     for ( int row = rowMin; row <= rowMax; row++ )
     {
-        qreal x = clipRect.left();
+        qreal x = clipRect.left() + listViewNode->columnX();
 
         for ( int col = colMin; col <= colMax; col++ )
         {
@@ -269,27 +441,113 @@ void QskListViewSkinlet::updateForegroundNodes(
             x += listView->columnWidth( col );
         }
 
-        y += rowHeight;
+        y += listView->rowHeightAt( row );
+    }
+}
+
+bool QskListViewSkinlet::updateBatchedForegroundNode(
+    const QskListView* listView, QSGNode* parentNode ) const
+{
+    using Q = QskListView;
+    using namespace QskSGNode;
+
+    auto foregroundNode = static_cast< ForegroundNode* >( parentNode );
+    auto listViewNode = static_cast< const ListViewNode* >( parentNode->parent() );
+
+    const auto clipRect = listViewNode->clipRect();
+    const auto margins = listView->paddingHint( Q::Cell );
+
+    const auto alignment = listView->alignmentHint(
+        Q::Cell, Qt::AlignVCenter | Qt::AlignLeft );
+
+    // the values are shared with the nodes of the unbatched cells
+    foregroundNode->rearrangeValues( listView,
+        listViewNode->rowMin(), listViewNode->rowMax(),
+        listViewNode->columnMin(), listViewNode->columnMax() );
+
+    QVector< QskBatchedTextNode::Text > texts;
+    texts.reserve( listViewNode->rowCount() * listViewNode->columnCount() );
+
+    for ( int row = listViewNode->rowMin(); row <= listViewNode->rowMax(); row++ )
+    {
+        QskSkinStateChanger stateChanger( listView );
+        stateChanger.setStates( sampleStates( listView, Q::Cell, row ), row );
+
+        QskBatchedTextNode::Text text;
+
+        text.font = listView->effectiveFont( Q::Text );
+        text.options = listView->textOptionsHint( Q::Text );
+        text.alignment = alignment;
+        text.color = qskTextColor( listView, Q::Text );
+        text.styleColor = listView->color( Q::Text | QskAspect::StyleColor );
+
+        if ( text.styleColor.isValid() )
+        {
+            text.style = listView->flagHint< Qsk::TextStyle >(
+                Q::Text | QskAspect::Style, Qsk::Normal );
+        }
+
+        if ( !QskBatchedTextNode::isBatchable( text.options ) )
+            return false;
+
+        const auto y = clipRect.top() + listView->rowPosition( row ) + margins.top();
+        const auto h = listView->rowHeightAt( row ) - ( margins.top() + margins.bottom() );
+
+        qreal x = clipRect.left() + listViewNode->columnX();
+
+        for ( int col = listViewNode->columnMin(); col <= listViewNode->columnMax(); col++ )
+        {
+            const auto value = foregroundNode->valueAt( listView, row, col );
+            if ( value.canConvert< QskGraphic >() || !value.canConvert< QString >() )
+                return false;
+
+            const auto w = listView->columnWidth( col );
+
+            text.text = value.toString();
+            text.rect = QRectF( x + margins.left(), y,
+                w - ( margins.left() + margins.right() ), h );
+
+            texts += text;
+
+            x += w;
+        }
+    }
+
+    auto node = static_cast< QskBatchedTextNode* >( foregroundNode->firstChild() );
+
+    if ( nodeRole( node ) != TextBatchRole )
+    {
+        removeAllChildNodesFrom( foregroundNode, foregroundNode->firstChild() );
+
+        node = appendChildNode< QskBatchedTextNode >( foregroundNode, TextBatchRole );
     }
+
+    node->updateNode( listView, texts );
+
+    return true;
 }
 
 void QskListViewSkinlet::updateVisibleForegroundNodes(
     const QskListView* listView, QSGNode* parentNode,
-    int rowMin, int rowMax, const QMarginsF& margins ) const
+    int rowMin, int rowMax, int colMin, int colMax,
+    const QMarginsF& margins ) const
 {
+    auto foregroundNode = static_cast< ForegroundNode* >( parentNode );
+
     auto node = parentNode->firstChild();
 
     for ( int row = rowMin; row <= rowMax; row++ )
     {
-        const auto h = listView->rowHeight() - ( margins.top() + margins.bottom() );
+        const auto h = listView->rowHeightAt( row ) - ( margins.top() + margins.bottom() );
 
-        for ( int col = 0; col < listView->columnCount(); col++ )
+        for ( int col = colMin; col <= colMax; col++ )
         {
             const auto w = listView->columnWidth( col ) - ( margins.left() + margins.right() );
+            const auto value = foregroundNode->valueAt( listView, row, col );
 
             node = updateForegroundNode( listView,
                 parentNode, static_cast< QSGTransformNode* >( node ),
-                row, col, QSizeF( w, h ) );
+                row, col, value, QSizeF( w, h ) );
 
             node = node->nextSibling();
         }
@@ -300,7 +558,7 @@ void QskListViewSkinlet::updateVisibleForegroundNodes(
 
 QSGTransformNode* QskListViewSkinlet::updateForegroundNode(
     const QskListView* listView, QSGNode* parentNode, QSGTransformNode* cellNode,
-    int row, int col, const QSizeF& size ) const
+    int row, int col, const QVariant& value, const QSizeF& size ) const
 {
     const QRectF cellRect( 0.0, 0.0, size.width(), size.height() );
 
@@ -314,7 +572,7 @@ QSGTransformNode* QskListViewSkinlet::updateForegroundNode(
     {
         QSGNode* oldNode = cellNode;
 
-        auto newNode = updateCellNode( listView, oldNode, cellRect, row, col );
+        auto newNode = updateCellNode( listView, oldNode, cellRect, row, col, value );
         if ( newNode )
         {
             if ( newNode->type() == QSGNode::TransformNodeType )
@@ -331,7 +589,7 @@ QSGTransformNode* QskListViewSkinlet::updateForegroundNode(
     else
     {
         QSGNode* oldNode = cellNode ? cellNode->firstChild() : nullptr;
-        auto newNode = updateCellNode( listView, oldNode, cellRect, row, col );
+        auto newNode = updateCellNode( listView, oldNode, cellRect, row, col, value );
 
         if ( newNode )
         {
@@ -380,7 +638,8 @@ QSGTransformNode* QskListViewSkinlet::updateForegroundNode(
 }
 
 QSGNode* QskListViewSkinlet::updateCellNode( const QskListView* listView,
-    QSGNode* contentNode, const QRectF& rect, int row, int col ) const
+    QSGNode* contentNode, const QRectF& rect, int row, int col,
+    const QVariant& value ) const
 {
     using Q = QskListView;
     using namespace QskSGNode;
@@ -400,7 +659,7 @@ QSGNode* QskListViewSkinlet::updateCellNode( const QskListView* listView,
     const auto alignment = listView->alignmentHint(
         Q::Cell, Qt::AlignVCenter | Qt::AlignLeft );
 
-    const auto value = listView->valueAt( row, col );
+    Q_UNUSED( col );
 
     if ( value.canConvert< QskGraphic >() )
     {
@@ -480,9 +739,9 @@ QRectF QskListViewSkinlet::sampleRect( const QskSkinnable* skinnable,
         const auto clipRect = node ? node->clipRect() : listView->viewContentsRect();
 
         const auto w = clipRect.width();
-        const auto h = listView->rowHeight();
+        const auto h = listView->rowHeightAt( index );
         const auto x = clipRect.left() + listView->scrollPos().x();
-        const auto y = clipRect.top() + index * h;
+        const auto y = clipRect.top() + listView->rowPosition( index );
 
         return QRectF( x, y, w, h );
     }
@@ -14,6 +14,7 @@ class QMarginsF;
 class QSizeF;
 class QRectF;
 class QSGTransformNode;
+class QVariant;
 
 class QSK_EXPORT QskListViewSkinlet : public QskScrollViewSkinlet
 {
@@ -26,6 +27,8 @@ class QSK_EXPORT QskListViewSkinlet : public QskScrollViewSkinlet
     {
         TextRole = Inherited::RoleCount,
         GraphicRole,
+        CellRole,
+        TextBatchRole,
 
         RoleCount
     };
@@ -50,16 +53,18 @@ class QSK_EXPORT QskListViewSkinlet : public QskScrollViewSkinlet
     void updateForegroundNodes( const QskListView*, QSGNode* ) const;
     void updateBackgroundNodes( const QskListView*, QSGNode* ) const;
 
+    bool updateBatchedForegroundNode( const QskListView*, QSGNode* ) const;
+
     void updateVisibleForegroundNodes(
-        const QskListView*, QSGNode*,
-        int rowMin, int rowMax, const QMarginsF& margin ) const;
+        const QskListView*, QSGNode*, int rowMin, int rowMax,
+        int colMin, int colMax, const QMarginsF& margin ) const;
 
     QSGTransformNode* updateForegroundNode( const QskListView*,
         QSGNode* parentNode, QSGTransformNode* cellNode,
-        int row, int col, const QSizeF& ) const;
+        int row, int col, const QVariant&, const QSizeF& ) const;
 
-    QSGNode* updateCellNode( const QskListView*,
-        QSGNode*, const QRectF&, int row, int col ) const;
+    QSGNode* updateCellNode( const QskListView*, QSGNode*,
+        const QRectF&, int row, int col, const QVariant& ) const;
 };
 
 #endif
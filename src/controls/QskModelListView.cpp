@@ -0,0 +1,395 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) The authors
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#include "QskModelListView.h"
+#include "QskFunctions.h"
+#include "QskGraphic.h"
+
+#include <qabstractitemmodel.h>
+#include <qfontmetrics.h>
+#include <qmap.h>
+#include <qpointer.h>
+
+static inline QVariant qskValue(
+    const QAbstractItemModel* model, int row, int col )
+{
+    const auto index = model->index( row, col );
+
+#if QT_VERSION >= QT_VERSION_CHECK( 6, 0, 0 )
+    // one virtual call for both roles
+    QModelRoleData roleData[] =
+        { QModelRoleData( Qt::DisplayRole ), QModelRoleData( Qt::DecorationRole ) };
+    model->multiData( index, roleData );
+
+    const auto& display = roleData[0].data();
+    const auto& decoration = roleData[1].data();
+#else
+    const auto display = model->data( index, Qt::DisplayRole );
+    const auto decoration = model->data( index, Qt::DecorationRole );
+#endif
+
+    if ( !display.isValid() && decoration.canConvert< QskGraphic >() )
+        return decoration;
+
+    return display;
+}
+
+class QskModelListView::PrivateData
+{
+  public:
+    void clearValues()
+    {
+        firstRow = 0;
+        cachedRows = 0;
+        values.clear();
+    }
+
+    inline int cacheIndex( int row, int col ) const
+    {
+        if ( row < firstRow || row >= firstRow + cachedRows
+            || col < 0 || col >= cachedColumns )
+        {
+            return -1;
+        }
+
+        return ( row - firstRow ) * cachedColumns + col;
+    }
+
+    void fetchValues( int from, int to )
+    {
+        /*
+            Fetching the values of all visible rows in one go.
+            Rows, that have been fetched before, are reused.
+         */
+        const int columnCount = model ? model->columnCount() : 0;
+
+        if ( from > to || columnCount <= 0 )
+        {
+            clearValues();
+            return;
+        }
+
+        if ( from == firstRow && to == firstRow + cachedRows - 1
+            && columnCount == cachedColumns )
+        {
+            return;
+        }
+
+        QVector< QVariant > newValues;
+        newValues.reserve( ( to - from + 1 ) * columnCount );
+
+        for ( int row = from; row <= to; row++ )
+        {
+            for ( int col = 0; col < columnCount; col++ )
+            {
+                const auto index = ( columnCount == cachedColumns )
+                    ? cacheIndex( row, col ) : -1;
+
+                if ( index >= 0 )
+                    newValues += values[ index ];
+                else
+                    newValues += qskValue( model, row, col );
+            }
+        }
+
+        values = newValues;
+
+        firstRow = from;
+        cachedRows = to - from + 1;
+        cachedColumns = columnCount;
+    }
+
+    QPointer< QAbstractItemModel > model;
+
+    QMap< int, qreal > columnWidths;
+
+    // the values of the rows [ firstRow, firstRow + cachedRows [
+    QVector< QVariant > values;
+
+    int firstRow = 0;
+    int cachedRows = 0;
+    int cachedColumns = 0;
+
+    bool fetchPending = false;
+};
+
+QskModelListView::QskModelListView( QQuickItem* parent )
+    : Inherited( parent )
+    , m_data( new PrivateData() )
+{
+    connect( this, &QskScrollView::scrollPosChanged, this, &QQuickItem::polish );
+}
+
+QskModelListView::QskModelListView(
+        QAbstractItemModel* model, QQuickItem* parent )
+    : QskModelListView( parent )
+{
+    setModel( model );
+}
+
+QskModelListView::~QskModelListView()
+{
+}
+
+void QskModelListView::setModel( QAbstractItemModel* model )
+{
+    if ( model == m_data->model )
+        return;
+
+    if ( m_data->model )
+        m_data->model->disconnect( this );
+
+    m_data->model = model;
+
+    if ( model )
+    {
+        using M = QAbstractItemModel;
+
+        connect( model, &M::dataChanged, this, &QskModelListView::dataChanged );
+        connect( model, &M::rowsInserted, this, &QskModelListView::rowsInserted );
+        connect( model, &M::rowsRemoved, this, &QskModelListView::rowsRemoved );
+
+        connect( model, &M::modelReset, this, &QskModelListView::resetModel );
+        connect( model, &M::layoutChanged, this, &QskModelListView::resetModel );
+        connect( model, &M::rowsMoved, this, &QskModelListView::resetModel );
+        connect( model, &M::columnsInserted, this, &QskModelListView::resetModel );
+        connect( model, &M::columnsRemoved, this, &QskModelListView::resetModel );
+        connect( model, &M::columnsMoved, this, &QskModelListView::resetModel );
+
+        connect( model, &QObject::destroyed, this, [ this ]()
+        {
+            // m_data->model is already null
+            resetModel();
+            Q_EMIT modelChanged();
+        } );
+    }
+
+    resetModel();
+
+    Q_EMIT modelChanged();
+}
+
+QAbstractItemModel* QskModelListView::model() const
+{
+    return m_data->model;
+}
+
+void QskModelListView::setColumnWidth( int column, qreal width )
+{
+    if ( column < 0 )
+        return;
+
+    width = qMax( width, 0.0 );
+
+    auto it = m_data->columnWidths.find( column );
+    if ( it != m_data->columnWidths.end() && it.value() == width )
+        return;
+
+    m_data->columnWidths[ column ] = width;
+
+    updateScrollableSize();
+    update();
+}
+
+void QskModelListView::resetColumnWidth( int column )
+{
+    if ( m_data->columnWidths.remove( column ) > 0 )
+    {
+        updateScrollableSize();
+        update();
+    }
+}
+
+int QskModelListView::rowCount() const
+{
+    return m_data->model ? m_data->model->rowCount() : 0;
+}
+
+int QskModelListView::columnCount() const
+{
+    return m_data->model ? m_data->model->columnCount() : 0;
+}
+
+qreal QskModelListView::columnWidth( int col ) const
+{
+    if ( col < 0 || col >= columnCount() )
+        return 0.0;
+
+    const auto it = m_data->columnWidths.constFind( col );
+    if ( it != m_data->columnWidths.constEnd() )
+        return it.value();
+
+    const auto& model = m_data->model;
+
+    const auto sizeHint = model->headerData(
+        col, Qt::Horizontal, Qt::SizeHintRole ).toSizeF();
+
+    if ( sizeHint.width() > 0.0 )
+        return sizeHint.width();
+
+    qreal w = strutSizeHint( Cell ).width();
+
+    const auto title = model->headerData(
+        col, Qt::Horizontal, Qt::DisplayRole ).toString();
+
+    if ( !title.isEmpty() )
+    {
+        const auto padding = paddingHint( Cell );
+
+        const auto tw = qskHorizontalAdvance( effectiveFont( Text ), title )
+            + padding.left() + padding.right();
+
+        w = qMax( w, tw );
+    }
+
+    return w;
+}
+
+qreal QskModelListView::rowHeight() const
+{
+    const auto hint = strutSizeHint( Cell );
+    const auto padding = paddingHint( Cell );
+
+    qreal h = effectiveFontHeight( Text );
+    h += padding.top() + padding.bottom();
+
+    return qMax( h, hint.height() );
+}
+
+QVariant QskModelListView::valueAt( int row, int col ) const
+{
+    const auto index = m_data->cacheIndex( row, col );
+    if ( index >= 0 )
+        return m_data->values[ index ];
+
+    if ( m_data->model && row >= 0 && row < rowCount()
+        && col >= 0 && col < columnCount() )
+    {
+        return qskValue( m_data->model, row, col );
+    }
+
+    return QVariant();
+}
+
+void QskModelListView::updateResources()
+{
+    Inherited::updateResources();
+
+    const int count = rowCount();
+    if ( count <= 0 )
+    {
+        m_data->clearValues();
+        return;
+    }
+
+    const auto y = scrollPos().y();
+    const auto h = viewContentsRect().height();
+
+    int from = qMax( rowAt( y ), 0 );
+    int to = qMin( rowAt( y + h ), count - 1 );
+
+    if ( to >= count - 1 && !m_data->fetchPending
+        && m_data->model->canFetchMore( QModelIndex() ) )
+    {
+        // not modifying the model, while being in the polish cycle
+        m_data->fetchPending = true;
+        QMetaObject::invokeMethod( this,
+            [ this ]() { fetchMore(); }, Qt::QueuedConnection );
+    }
+
+    // prefetching half a page in both directions for flicking
+    const int extra = ( to - from + 1 ) / 2;
+
+    from = qMax( from - extra, 0 );
+    to = qMin( to + extra, count - 1 );
+
+    m_data->fetchValues( from, to );
+}
+
+void QskModelListView::fetchMore()
+{
+    m_data->fetchPending = false;
+
+    if ( auto model = m_data->model.data() )
+    {
+        if ( model->canFetchMore( QModelIndex() ) )
+            model->fetchMore( QModelIndex() );
+    }
+}
+
+void QskModelListView::resetModel()
+{
+    m_data->clearValues();
+
+    if ( selectedRow() >= rowCount() )
+        setSelectedRow( -1 );
+
+    updateScrollableSize();
+    invalidateContents();
+
+    polish();
+}
+
+void QskModelListView::dataChanged(
+    const QModelIndex& topLeft, const QModelIndex& bottomRight )
+{
+    if ( topLeft.parent().isValid() )
+        return;
+
+    const int first = topLeft.row();
+    const int last = bottomRight.row();
+
+    for ( int row = first; row <= last; row++ )
+    {
+        for ( int col = topLeft.column(); col <= bottomRight.column(); col++ )
+        {
+            const auto index = m_data->cacheIndex( row, col );
+            if ( index >= 0 )
+                m_data->values[ index ] = qskValue( m_data->model, row, col );
+        }
+    }
+
+    rowsChanged( first, last );
+}
+
+void QskModelListView::rowsInserted( const QModelIndex& parent, int first, int last )
+{
+    if ( parent.isValid() )
+        return;
+
+    m_data->clearValues();
+
+    const int row = selectedRow();
+    if ( row >= first )
+        setSelectedRow( row + last - first + 1 );
+
+    updateScrollableSize();
+
+    // the rows before first are unaffected
+    rowsChanged( first, rowCount() - 1 );
+
+    polish();
+}
+
+void QskModelListView::rowsRemoved( const QModelIndex& parent, int first, int last )
+{
+    if ( parent.isValid() )
+        return;
+
+    m_data->clearValues();
+
+    const int row = selectedRow();
+    if ( row >= first )
+        setSelectedRow( ( row <= last ) ? -1 : row - ( last - first + 1 ) );
+
+    updateScrollableSize();
+
+    rowsChanged( first, rowCount() - 1 );
+    update();
+
+    polish();
+}
+
+#include "moc_QskModelListView.cpp"
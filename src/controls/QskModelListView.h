@@ -0,0 +1,75 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) The authors
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#ifndef QSK_MODEL_LIST_VIEW_H
+#define QSK_MODEL_LIST_VIEW_H
+
+#include "QskListView.h"
+
+class QAbstractItemModel;
+class QModelIndex;
+
+/*
+    A list view displaying the Qt::DisplayRole ( or Qt::DecorationRole,
+    when being a QskGraphic ) of the top level rows of a QAbstractItemModel.
+
+    The values of the visible rows are fetched in one go, when polishing
+    the view and are kept until the rows are modified. Models supporting
+    incremental loading ( canFetchMore/fetchMore ) are asked for more rows,
+    when the end of the list becomes visible.
+ */
+class QSK_EXPORT QskModelListView : public QskListView
+{
+    Q_OBJECT
+
+    Q_PROPERTY( QAbstractItemModel* model READ model
+        WRITE setModel NOTIFY modelChanged )
+
+    using Inherited = QskListView;
+
+  public:
+    QskModelListView( QQuickItem* parent = nullptr );
+    QskModelListView( QAbstractItemModel*, QQuickItem* parent = nullptr );
+
+    ~QskModelListView() override;
+
+    void setModel( QAbstractItemModel* );
+    QAbstractItemModel* model() const;
+
+    /*
+        Columns without an explicit width are using the
+        Qt::SizeHintRole of the horizontal header of the model
+        or the strut size of the Cell subcontrol
+     */
+    void setColumnWidth( int column, qreal width );
+    void resetColumnWidth( int column );
+
+    int rowCount() const override final;
+    int columnCount() const override final;
+
+    qreal columnWidth( int col ) const override;
+    qreal rowHeight() const override;
+
+    QVariant valueAt( int row, int col ) const override final;
+
+  Q_SIGNALS:
+    void modelChanged();
+
+  protected:
+    void updateResources() override;
+
+  private:
+    void resetModel();
+    void fetchMore();
+
+    void dataChanged( const QModelIndex&, const QModelIndex& );
+    void rowsInserted( const QModelIndex&, int first, int last );
+    void rowsRemoved( const QModelIndex&, int first, int last );
+
+    class PrivateData;
+    std::unique_ptr< PrivateData > m_data;
+};
+
+#endif
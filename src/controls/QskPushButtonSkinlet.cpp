@@ -6,9 +6,11 @@
 #include "QskPushButtonSkinlet.h"
 #include "QskPushButton.h"
 #include "QskTextOptions.h"
+#include "QskTextRenderer.h"
 
 #include "QskAnimationHint.h"
 #include "QskGraphic.h"
+#include "QskSubcontrolLayoutCache.h"
 #include "QskSubcontrolLayoutEngine.h"
 #include "QskSGNode.h"
 
@@ -71,11 +73,7 @@ QRectF QskPushButtonSkinlet::subControlRect( const QskSkinnable* skinnable,
     if ( ( subControl == Q::Text ) || ( subControl == Q::Icon ) )
     {
         const auto r = button->subControlContentsRect( contentsRect, Q::Panel );
-
-        LayoutEngine layoutEngine( button );
-        layoutEngine.setGeometries( r );
-
-        return layoutEngine.subControlRect( subControl );
+        return qskSubcontrolLayoutRect< LayoutEngine >( button, r, -1, subControl, button );
     }
 
     return Inherited::subControlRect( skinnable, contentsRect, subControl );
@@ -193,4 +191,26 @@ QSizeF QskPushButtonSkinlet::sizeHint( const QskSkinnable* skinnable,
     return size;
 }
 
+void QskPushButtonSkinlet::collectMeasurements(
+    const QskSkinnable* skinnable, Measurements& measurements ) const
+{
+    using Q = QskPushButton;
+
+    const auto button = static_cast< const QskPushButton* >( skinnable );
+
+    const auto text = button->text();
+    if ( text.isEmpty() )
+        return;
+
+    // the same parameters as being used by the TextElement of the layout engine
+    const auto textOptions = button->textOptionsHint( Q::Text );
+    if ( textOptions.effectiveFormat( text ) != QskTextOptions::PlainText )
+        return;
+
+    const auto font = button->effectiveFont( Q::Text );
+
+    measurements.push_back( [ text, font, textOptions ]()
+        { QskTextRenderer::textSize( text, font, textOptions ); } );
+}
+
 #include "moc_QskPushButtonSkinlet.cpp"
@@ -36,6 +36,8 @@ class QSK_EXPORT QskPushButtonSkinlet : public QskSkinlet
     QSizeF sizeHint( const QskSkinnable*,
         Qt::SizeHint, const QSizeF& ) const override;
 
+    void collectMeasurements( const QskSkinnable*, Measurements& ) const override;
+
   protected:
     QSGNode* updateSubNode( const QskSkinnable*,
         quint8 nodeRole, QSGNode* ) const override;
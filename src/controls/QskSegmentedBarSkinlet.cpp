@@ -10,9 +10,11 @@
 #include "QskGraphic.h"
 #include "QskColorFilter.h"
 #include "QskFunctions.h"
+#include "QskInstancedBoxNode.h"
 #include "QskSGNode.h"
 #include "QskSkin.h"
 #include "QskSkinStateChanger.h"
+#include "QskSubcontrolLayoutCache.h"
 #include "QskSubcontrolLayoutEngine.h"
 #include "QskBoxHints.h"
 
@@ -305,10 +307,10 @@ QSGNode* QskSegmentedBarSkinlet::updateSubNode(
             return updateBoxNode( skinnable, node, Q::Panel );
 
         case SegmentRole:
-            return updateSeriesNode( skinnable, Q::Segment, node );
+            return updateBoxesNode( bar, nodeRole, Q::Segment, node );
 
         case SeparatorRole:
-            return updateSeriesNode( skinnable, Q::Separator, node );
+            return updateBoxesNode( bar, nodeRole, Q::Separator, node );
 
         case TextRole:
             return updateSeriesNode( skinnable, Q::Text, node );
@@ -417,10 +419,8 @@ QRectF QskSegmentedBarSkinlet::sampleRect( const QskSkinnable* skinnable,
     {
         const auto rect = sampleRect( skinnable, contentsRect, Q::Segment, index );
 
-        LayoutEngine layoutEngine( bar, index );
-        layoutEngine.setGeometries( rect );
-
-        return layoutEngine.subControlRect( subControl );
+        return qskSubcontrolLayoutRect< LayoutEngine >(
+            bar, rect, index, subControl, bar, index );
     }
 
     return Inherited::sampleRect( skinnable, contentsRect, subControl, index );
@@ -567,4 +567,72 @@ QSGNode* QskSegmentedBarSkinlet::updateSplashNode(
     return clipNode;
 }
 
+QSGNode* QskSegmentedBarSkinlet::updateBoxesNode( const QskSegmentedBar* bar,
+    quint8 role, QskAspect::Subcontrol subControl, QSGNode* node ) const
+{
+    using Q = QskSegmentedBar;
+    using namespace QskSGNode;
+
+    /*
+        Segments and separators usually differ in their colors only.
+        So we try to render all of them with one QskInstancedBoxNode
+        and fall back to a node for each box otherwise.
+     */
+
+    QVector< QskInstancedBoxNode::Instance > instances;
+    instances.reserve( bar->count() );
+
+    for ( int i = 0; i < bar->count(); i++ )
+    {
+        QskSkinStateChanger stateChanger( bar );
+        stateChanger.setStates( sampleStates( bar, subControl, i ), i );
+
+        auto rect = sampleRect( bar, bar->contentsRect(), subControl, i );
+
+        QskBoxHints boxHints;
+
+        if ( subControl == Q::Segment )
+        {
+            boxHints = effectiveBoxHints( subControl, bar, i );
+        }
+        else
+        {
+            boxHints = bar->boxHints( subControl );
+            rect = rect.marginsRemoved( bar->marginHint( subControl ) );
+        }
+
+        if ( !QskInstancedBoxNode::isInstantiable( boxHints ) )
+        {
+            instances.clear();
+            break;
+        }
+
+        instances += QskInstancedBoxNode::Instance( rect, boxHints );
+    }
+
+    auto childNode = node ? node->firstChild() : nullptr;
+
+    if ( !instances.isEmpty() )
+    {
+        auto boxesNode = static_cast< QskInstancedBoxNode* >( childNode );
+
+        if ( nodeRole( childNode ) != role )
+        {
+            if ( node == nullptr )
+                node = new QSGNode();
+
+            removeAllChildNodesFrom( node, childNode );
+            boxesNode = appendChildNode< QskInstancedBoxNode >( node, role );
+        }
+
+        boxesNode->updateNode( bar->window(), instances );
+        return node;
+    }
+
+    if ( nodeRole( childNode ) == role )
+        removeAllChildNodesFrom( node, childNode );
+
+    return updateSeriesNode( bar, subControl, node );
+}
+
 #include "moc_QskSegmentedBarSkinlet.cpp"
@@ -64,6 +64,9 @@ class QSK_EXPORT QskSegmentedBarSkinlet : public QskSkinlet
     QRectF splashRect( const QskSegmentedBar*, const QRectF& ) const;
 
     QSGNode* updateSplashNode( const QskSegmentedBar*, QSGNode* ) const;
+
+    QSGNode* updateBoxesNode( const QskSegmentedBar*,
+        quint8 nodeRole, QskAspect::Subcontrol, QSGNode* ) const;
 };
 
 #endif
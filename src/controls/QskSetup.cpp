@@ -4,6 +4,11 @@
  *****************************************************************************/
 
 #include "QskSetup.h"
+#include "QskQuick.h"
+#include "QskTessellation.h"
+
+#include <qguiapplication.h>
+#include <qquickwindow.h>
 
 extern bool qskHasEnvironment( const char* );
 extern void qskUpdateItemFlags();
@@ -88,3 +93,25 @@ bool QskSetup::testUpdateFlag( QskItem::UpdateFlag flag )
 {
     return qskUpdateFlags.testFlag( flag );
 }
+
+void QskSetup::setTessellationTolerance( qreal tolerance )
+{
+    const auto oldTolerance = QskTessellation::tolerance();
+
+    QskTessellation::setTolerance( tolerance );
+    if ( QskTessellation::tolerance() == oldTolerance )
+        return;
+
+    // the nodes rebuild their geometries, when being updated
+    const auto windows = QGuiApplication::topLevelWindows();
+    for ( auto window : windows )
+    {
+        if ( auto quickWindow = qobject_cast< QQuickWindow* >( window ) )
+            qskItemUpdateRecursive( quickWindow->contentItem() );
+    }
+}
+
+qreal QskSetup::tessellationTolerance()
+{
+    return QskTessellation::tolerance();
+}
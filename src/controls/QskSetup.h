@@ -18,6 +18,15 @@ namespace QskSetup
     QSK_EXPORT void setUpdateFlag( QskItem::UpdateFlag, bool on = true );
     QSK_EXPORT void resetUpdateFlag( QskItem::UpdateFlag );
     QSK_EXPORT bool testUpdateFlag( QskItem::UpdateFlag );
+
+    /*
+        Max. distance ( in device pixels ) between arcs/rounded corners
+        and the polylines approximating them - for all windows.
+        Increasing the tolerance reduces the number of vertices:
+        see QskTessellation
+     */
+    QSK_EXPORT void setTessellationTolerance( qreal );
+    QSK_EXPORT qreal tessellationTolerance();
 };
 
 #endif
@@ -8,37 +8,205 @@
 #include "QskFunctions.h"
 
 #include <qfontmetrics.h>
+#include <qmap.h>
 
-static inline qreal qskMaxWidth(
-    const QFont& font, const QStringList& list )
+namespace
 {
-    const QFontMetricsF fm( font );
-
-    qreal max = 0.0;
-    for ( int i = 0; i < list.size(); i++ )
+    /*
+        The entries with their text widths. The entries on screen are measured,
+        when the width of the column is requested, all others are measured
+        in chunks later. The maximum is maintained in a map counting the
+        entries for each width, so that inserting/removing an entry is
+        O(log n) instead of rescanning all entries.
+     */
+    class EntryTable
     {
-        const qreal w = qskHorizontalAdvance( fm, list[ i ] );
-        if ( w > max )
-            max = w;
-    }
+      public:
+        inline int count() const { return m_entries.count(); }
+        inline bool isEmpty() const { return m_entries.isEmpty(); }
+
+        inline const QStringList& entries() const { return m_entries; }
+        inline const QString& entryAt( int index ) const { return m_entries[ index ]; }
+
+        void insert( int index, const QStringList& entries )
+        {
+            if ( entries.isEmpty() )
+                return;
+
+            if ( index < 0 || index > m_entries.count() )
+                index = m_entries.count();
+
+            if ( m_entries.isEmpty() )
+            {
+                m_entries = entries;
+            }
+            else if ( index == m_entries.count() )
+            {
+                m_entries += entries;
+            }
+            else
+            {
+                // O(n) instead of shifting the tail for each entry
+                QStringList list;
+                list.reserve( m_entries.count() + entries.count() );
+
+                list += m_entries.mid( 0, index );
+                list += entries;
+                list += m_entries.mid( index );
+
+                m_entries = list;
+            }
+
+            m_widths.insert( index, entries.count(), -1.0 );
+            m_unmeasuredCount += entries.count();
+
+            m_cursor = qMin( m_cursor, index );
+        }
+
+        void remove( int from, int to )
+        {
+            for ( int i = from; i <= to; i++ )
+            {
+                const auto w = m_widths[ i ];
+
+                if ( w >= 0.0 )
+                {
+                    auto it = m_widthCounts.find( w );
+                    if ( --it.value() == 0 )
+                        m_widthCounts.erase( it );
+                }
+                else
+                {
+                    m_unmeasuredCount--;
+                }
+            }
+
+            m_entries.erase( m_entries.begin() + from, m_entries.begin() + to + 1 );
+            m_widths.remove( from, to - from + 1 );
+
+            if ( m_cursor > to )
+                m_cursor -= to - from + 1;
+            else
+                m_cursor = qMin( m_cursor, from );
+        }
+
+        void clear()
+        {
+            m_entries.clear();
+            m_widths.clear();
+            m_widthCounts.clear();
+            m_unmeasuredCount = 0;
+            m_cursor = 0;
+        }
+
+        void setFont( const QFont& font )
+        {
+            if ( font != m_font )
+            {
+                // f.e. a different skin or a local font role hint
+                m_font = font;
+
+                m_widths.fill( -1.0 );
+                m_widthCounts.clear();
+                m_unmeasuredCount = m_entries.count();
+                m_cursor = 0;
+            }
+        }
+
+        inline bool isMeasured() const { return m_unmeasuredCount == 0; }
+
+        void measure( int from, int to )
+        {
+            from = qMax( from, 0 );
+            to = qMin( to, m_entries.count() - 1 );
+
+            if ( m_unmeasuredCount > 0 && from <= to )
+            {
+                const QFontMetricsF fm( m_font );
+
+                for ( int i = from; i <= to; i++ )
+                    measureAt( fm, i );
+            }
+        }
+
+        // measures up to count entries, that have not been measured before
+        void measureNext( int count )
+        {
+            const QFontMetricsF fm( m_font );
 
-    return max;
+            while ( m_unmeasuredCount > 0 && count > 0
+                && m_cursor < m_entries.count() )
+            {
+                if ( measureAt( fm, m_cursor ) )
+                    count--;
+
+                m_cursor++;
+            }
+        }
+
+        inline qreal maxWidth() const
+        {
+            return m_widthCounts.isEmpty() ? 0.0 : m_widthCounts.lastKey();
+        }
+
+      private:
+        inline bool measureAt( const QFontMetricsF& fm, int index )
+        {
+            if ( m_widths[ index ] >= 0.0 )
+                return false;
+
+            const auto w = qskHorizontalAdvance( fm, m_entries[ index ] );
+
+            m_widths[ index ] = w;
+            m_widthCounts[ w ]++;
+            m_unmeasuredCount--;
+
+            return true;
+        }
+
+        QStringList m_entries;
+        QFont m_font;
+
+        QVector< qreal > m_widths; // < 0: not measured yet
+        QMap< qreal, int > m_widthCounts;
+
+        int m_unmeasuredCount = 0;
+
+        // all entries before the cursor have been measured
+        int m_cursor = 0;
+    };
 }
 
 class QskSimpleListBox::PrivateData
 {
   public:
     PrivateData()
-        : maxTextWidth( 0.0 )
-        , columnWidthHint( 0.0 )
+        : columnWidthHint( 0.0 )
+        , entriesWidth( 0.0 )
+        , measuringPending( false )
     {
     }
 
+    void scheduleMeasuring( QskSimpleListBox* listBox )
+    {
+        if ( !( measuringPending || entries.isMeasured() ) )
+        {
+            // the entries off screen are measured in chunks, when being idle
+            measuringPending = true;
+
+            QMetaObject::invokeMethod( listBox,
+                [ listBox ]() { listBox->measureEntries(); }, Qt::QueuedConnection );
+        }
+    }
+
     // one column at the moment only
-    qreal maxTextWidth;
     qreal columnWidthHint;
 
-    QStringList entries;
+    // the width of the entries, that has been returned by columnWidth
+    qreal entriesWidth;
+    bool measuringPending;
+
+    EntryTable entries;
 };
 
 QskSimpleListBox::QskSimpleListBox( QQuickItem* parent )
@@ -55,16 +223,16 @@ QskSimpleListBox::~QskSimpleListBox()
 
 QString QskSimpleListBox::entryAt( int row ) const
 {
-    if ( row >= 0 && row < m_data->entries.size() )
-        return m_data->entries[ row ];
+    if ( row >= 0 && row < m_data->entries.count() )
+        return m_data->entries.entryAt( row );
 
     return QString();
 }
 
 QVariant QskSimpleListBox::valueAt( int row, int col ) const
 {
-    if ( col == 0 && row >= 0 && row < m_data->entries.size() )
-        return m_data->entries[ row ];
+    if ( col == 0 && row >= 0 && row < m_data->entries.count() )
+        return m_data->entries.entryAt( row );
 
     return QVariant();
 }
@@ -77,12 +245,6 @@ void QskSimpleListBox::setColumnWidthHint( int column, qreal width )
     if ( width != m_data->columnWidthHint )
     {
         m_data->columnWidthHint = qMax( width, qreal( 0.0 ) );
-
-        if ( m_data->columnWidthHint > 0.0 )
-            m_data->maxTextWidth = m_data->columnWidthHint;
-        else
-            m_data->maxTextWidth = qskMaxWidth( effectiveFont( Text ), m_data->entries );
-
         updateScrollableSize();
     }
 }
@@ -100,28 +262,7 @@ void QskSimpleListBox::insert( const QStringList& list, int index )
     if ( list.isEmpty() )
         return;
 
-    if ( m_data->columnWidthHint <= 0.0 )
-    {
-        const auto w = qskMaxWidth( effectiveFont( Text ), list );
-        if ( w > m_data->maxTextWidth )
-            m_data->maxTextWidth = w;
-    }
-
-    if ( m_data->entries.isEmpty() )
-    {
-        m_data->entries = list;
-    }
-    else if ( index < 0 || index >= m_data->entries.size() )
-    {
-        m_data->entries += list;
-    }
-    else
-    {
-        // is there no better way ???
-        for ( int i = 0; i < list.size(); i++ )
-            m_data->entries.insert( index + i, list[ i ] );
-    }
-
+    m_data->entries.insert( index, list );
     propagateEntries();
 }
 
@@ -131,32 +272,19 @@ void QskSimpleListBox::setEntries( const QStringList& entries )
         return;
 
     m_data->entries.clear();
+    m_data->entries.insert( -1, entries );
 
-    if ( m_data->columnWidthHint <= 0.0 )
-        m_data->maxTextWidth = 0.0;
-
-    insert( entries, -1 );
+    propagateEntries();
 }
 
 QStringList QskSimpleListBox::entries() const
 {
-    return m_data->entries;
+    return m_data->entries.entries();
 }
 
 void QskSimpleListBox::insert( const QString& text, int index )
 {
-    if ( m_data->columnWidthHint <= 0.0 )
-    {
-        const auto w = qskHorizontalAdvance( effectiveFont( Cell ), text );
-        if ( w > m_data->maxTextWidth )
-            m_data->maxTextWidth = w;
-    }
-
-    if ( index < 0 )
-        m_data->entries.append( text );
-    else
-        m_data->entries.insert( index, text );
-
+    m_data->entries.insert( index, QStringList( text ) );
     propagateEntries();
 }
 
@@ -164,24 +292,17 @@ void QskSimpleListBox::removeAt( int index )
 {
     auto& entries = m_data->entries;
 
-    if ( index < 0 || index >= entries.size() )
+    if ( index < 0 || index >= entries.count() )
         return;
 
-    if ( m_data->columnWidthHint <= 0.0 )
-    {
-        const auto w = qskHorizontalAdvance( effectiveFont( Cell ), entries[ index ] );
-        if ( w >= m_data->maxTextWidth )
-            m_data->maxTextWidth = qskMaxWidth( effectiveFont( Text ), entries );
-    }
-
-    entries.removeAt( index );
+    entries.remove( index, index );
 
     propagateEntries();
 
     int row = selectedRow();
     if ( row == index )
     {
-        row = qMin( row, m_data->entries.size() - 1 );
+        row = qMin( row, m_data->entries.count() - 1 );
 
         if ( row != selectedRow() )
             setSelectedRow( row );
@@ -195,17 +316,13 @@ void QskSimpleListBox::removeBulk( int from, int to )
     if ( from < 0 )
         from = 0;
 
-    if ( to < 0 || to >= m_data->entries.size() - 1 )
-        to = m_data->entries.size() - 1;
+    if ( to < 0 || to >= m_data->entries.count() - 1 )
+        to = m_data->entries.count() - 1;
 
     if ( to < from )
         return;
 
-    for ( int i = to; i >= from; i-- )
-        m_data->entries.removeAt( i );
-
-    if ( m_data->columnWidthHint <= 0.0 )
-        m_data->maxTextWidth = qskMaxWidth( effectiveFont( Text ), m_data->entries );
+    m_data->entries.remove( from, to );
 
     propagateEntries();
 
@@ -223,7 +340,7 @@ void QskSimpleListBox::removeBulk( int from, int to )
         else if ( row <= to )
         {
             // we might end up here with the same row TODO ...
-            row = qMin( from, m_data->entries.size() - 1 );
+            row = qMin( from, m_data->entries.count() - 1 );
         }
         else
         {
@@ -244,9 +361,6 @@ void QskSimpleListBox::clear()
 
     m_data->entries.clear();
 
-    if ( m_data->columnWidthHint <= 0.0 )
-        m_data->maxTextWidth = 0.0;
-
     propagateEntries();
     setSelectedRow( -1 );
 }
@@ -257,14 +371,35 @@ void QskSimpleListBox::propagateEntries()
     // when removing we might have lost the selected row -> what to do then ?
 #endif
     updateScrollableSize();
-    update();
+    invalidateContents();
 
     Q_EMIT entriesChanged();
 }
 
+void QskSimpleListBox::measureEntries()
+{
+    m_data->measuringPending = false;
+
+    if ( m_data->columnWidthHint > 0.0 )
+        return;
+
+    auto& entries = m_data->entries;
+    entries.setFont( effectiveFont( Text ) );
+
+    entries.measureNext( 1000 );
+
+    if ( entries.maxWidth() != m_data->entriesWidth )
+    {
+        updateScrollableSize();
+        update();
+    }
+
+    m_data->scheduleMeasuring( this );
+}
+
 int QskSimpleListBox::rowCount() const
 {
-    return m_data->entries.size();
+    return m_data->entries.count();
 }
 
 int QskSimpleListBox::columnCount() const
@@ -277,8 +412,23 @@ qreal QskSimpleListBox::columnWidth( int col ) const
     if ( col >= columnCount() )
         return 0.0;
 
+    auto w = m_data->columnWidthHint;
+    if ( w <= 0.0 )
+    {
+        auto& entries = m_data->entries;
+        entries.setFont( effectiveFont( Text ) );
+
+        // the entries on screen are needed now
+        const auto y = scrollPos().y();
+        entries.measure( rowAt( y ), rowAt( y + height() ) );
+
+        m_data->scheduleMeasuring( const_cast< QskSimpleListBox* >( this ) );
+
+        w = m_data->entriesWidth = entries.maxWidth();
+    }
+
     const auto padding = paddingHint( Cell );
-    return m_data->maxTextWidth + padding.left() + padding.right();
+    return w + padding.left() + padding.right();
 }
 
 qreal QskSimpleListBox::rowHeight() const
@@ -59,6 +59,7 @@ class QSK_EXPORT QskSimpleListBox : public QskListView
 
   private:
     void propagateEntries();
+    void measureEntries();
 
     class PrivateData;
     std::unique_ptr< PrivateData > m_data;
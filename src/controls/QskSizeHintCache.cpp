@@ -0,0 +1,52 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) The authors
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#include "QskSizeHintCache.h"
+
+// size hints are calculated in the GUI thread only
+static QskSizeHintCache::Statistics qskStatistics;
+
+bool QskSizeHintCache::find(
+    Qt::SizeHint which, const QSizeF& constraint, QSizeF& hint ) const
+{
+    for ( int i = 0; i < m_count; i++ )
+    {
+        const auto& slot = m_slots[i];
+
+        if ( slot.which == which && slot.constraint == constraint )
+        {
+            hint = slot.hint;
+            qskStatistics.hits++;
+
+            return true;
+        }
+    }
+
+    qskStatistics.misses++;
+    return false;
+}
+
+void QskSizeHintCache::insert(
+    Qt::SizeHint which, const QSizeF& constraint, const QSizeF& hint )
+{
+    auto& slot = m_slots[ m_next ];
+
+    slot.which = which;
+    slot.constraint = constraint;
+    slot.hint = hint;
+
+    m_next = ( m_next + 1 ) % SlotCount;
+    m_count = qMin( m_count + 1, int( SlotCount ) );
+}
+
+QskSizeHintCache::Statistics QskSizeHintCache::statistics()
+{
+    return qskStatistics;
+}
+
+void QskSizeHintCache::resetStatistics()
+{
+    qskStatistics = Statistics();
+}
@@ -0,0 +1,72 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) The authors
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#ifndef QSK_SIZE_HINT_CACHE_H
+#define QSK_SIZE_HINT_CACHE_H
+
+#include "QskGlobal.h"
+#include <qsize.h>
+
+/*
+    A small cache for the implicit size hints of a control: f.e the
+    results of heightForWidth, that are requested several times from
+    the layout engines for the same width.
+
+    The cache has a fixed number of slots, that are recycled
+    in round robin order. It has to be cleared, whenever the
+    implicit size of the control is reset.
+ */
+class QskSizeHintCache
+{
+  public:
+    class Statistics
+    {
+      public:
+        inline qreal hitRate() const
+        {
+            const auto count = hits + misses;
+            return count ? qreal( hits ) / count : 0.0;
+        }
+
+        quint64 hits = 0;
+        quint64 misses = 0;
+    };
+
+    QskSizeHintCache() = default;
+
+    bool find( Qt::SizeHint, const QSizeF& constraint, QSizeF& hint ) const;
+    void insert( Qt::SizeHint, const QSizeF& constraint, const QSizeF& hint );
+
+    void clear();
+
+    /*
+        Counters for all controls. To get the numbers of a single
+        layout pass, the statistics can be reset before running it.
+     */
+    QSK_EXPORT static Statistics statistics();
+    QSK_EXPORT static void resetStatistics();
+
+  private:
+    static constexpr int SlotCount = 8;
+
+    struct Slot
+    {
+        QSizeF constraint;
+        QSizeF hint;
+        int which;
+    };
+
+    Slot m_slots[ SlotCount ];
+
+    int m_count = 0;
+    int m_next = 0;
+};
+
+inline void QskSizeHintCache::clear()
+{
+    m_count = m_next = 0;
+}
+
+#endif
@@ -19,6 +19,7 @@
 #include "QskSkinManager.h"
 #include "QskSkinTransition.h"
 
+#include <qfontmetrics.h>
 #include <qguiapplication.h>
 #include <qpa/qplatformdialoghelper.h>
 #include <qpa/qplatformtheme.h>
@@ -170,14 +171,54 @@ namespace
     };
 }
 
+namespace
+{
+    class FontCacheEntry
+    {
+      public:
+        QFont font;
+
+        // metrics for the pixel size of the font ( key: -1 ) and
+        // the pixel sizes of a running font size transition
+        QHash< int, QskSkin::FontMetrics > metrics;
+    };
+}
+
+static inline QskSkin::FontMetrics qskFontMetrics( const QFont& font )
+{
+    const QFontMetricsF fm( font );
+
+    QskSkin::FontMetrics metrics;
+    metrics.height = fm.height();
+    metrics.ascent = fm.ascent();
+    metrics.averageCharWidth = fm.averageCharWidth();
+
+    return metrics;
+}
+
 class QskSkin::PrivateData
 {
   public:
+    FontCacheEntry& fontCacheEntry( const QskFontRole& fontRole )
+    {
+        auto it = fontCache.find( fontRole );
+        if ( it == fontCache.end() )
+        {
+            FontCacheEntry entry;
+            entry.font = qskResolvedFont( fonts, fontRole );
+
+            it = fontCache.insert( fontRole, entry );
+        }
+
+        return it.value();
+    }
+
     QHash< const QMetaObject*, SkinletData > skinletMap;
 
     QskSkinHintTable hintTable;
 
     QHash< QskFontRole, QFont > fonts;
+    QHash< QskFontRole, FontCacheEntry > fontCache; // resolved fonts
     QHash< int, QskColorFilter > graphicFilters;
 
     QskGraphicProviderMap graphicProviders;
@@ -223,6 +264,13 @@ QskSkin::QskSkin( QObject* parent )
     const QFont font = QGuiApplication::font();
     setupFontTable( font.family(), font.italic() );
 
+    if ( qGuiApp )
+    {
+        // fonts of roles missing in the table fall back to the application font
+        connect( qGuiApp, &QGuiApplication::fontChanged,
+            this, [ this ]() { m_data->fontCache.clear(); } );
+    }
+
     const auto noMargins = QVariant::fromValue( QskMargins( 0 ) );
 
     {
@@ -384,21 +432,46 @@ void QskSkin::completeFontTable()
             m_data->fonts[ { category, emphasis } ] = font;
         }
     }
+
+    m_data->fontCache.clear();
 }
 
 void QskSkin::setFont( const QskFontRole& fontRole, const QFont& font )
 {
     m_data->fonts[ fontRole ] = font;
+    m_data->fontCache.clear();
 }
 
 void QskSkin::resetFont( const QskFontRole& fontRole )
 {
     m_data->fonts.remove( fontRole );
+    m_data->fontCache.clear();
 }
 
 QFont QskSkin::font( const QskFontRole& fontRole ) const
 {
-    return qskResolvedFont( m_data->fonts, fontRole );
+    return m_data->fontCacheEntry( fontRole ).font;
+}
+
+QskSkin::FontMetrics QskSkin::fontMetrics(
+    const QskFontRole& fontRole, int pixelSize ) const
+{
+    auto& entry = m_data->fontCacheEntry( fontRole );
+
+    if ( pixelSize <= 0 || pixelSize == entry.font.pixelSize() )
+        pixelSize = -1;
+
+    auto it = entry.metrics.constFind( pixelSize );
+    if ( it == entry.metrics.constEnd() )
+    {
+        auto font = entry.font;
+        if ( pixelSize > 0 )
+            font.setPixelSize( pixelSize );
+
+        it = entry.metrics.insert( pixelSize, qskFontMetrics( font ) );
+    }
+
+    return it.value();
 }
 
 void QskSkin::setGraphicFilter( int graphicRole, const QskColorFilter& colorFilter )
@@ -456,6 +529,7 @@ void QskSkin::clearHints()
 {
     m_data->hintTable.clear();
     m_data->fonts.clear();
+    m_data->fontCache.clear();
     m_data->graphicFilters.clear();
     m_data->graphicProviders.clear();
 }
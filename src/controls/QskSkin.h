@@ -46,6 +46,14 @@ class QSK_EXPORT QskSkin : public QObject
     Q_ENUM( ColorScheme )
 #endif
 
+    class FontMetrics
+    {
+      public:
+        qreal height = 0.0;
+        qreal ascent = 0.0;
+        qreal averageCharWidth = 0.0;
+    };
+
     QskSkin( QObject* parent = nullptr );
     ~QskSkin() override;
 
@@ -63,6 +71,13 @@ class QSK_EXPORT QskSkin : public QObject
     void resetFont( const QskFontRole& );
     QFont font( const QskFontRole& ) const;
 
+    /*
+        The metrics of font(), with pixelSize > 0 replacing the pixel size
+        of the font ( f.e. during a font size transition ).
+        Fonts and metrics are cached until the font table changes.
+     */
+    FontMetrics fontMetrics( const QskFontRole&, int pixelSize = -1 ) const;
+
     void addGraphicProvider( const QString& providerId, QskGraphicProvider* );
     QskGraphicProvider* graphicProvider( const QString& providerId ) const;
     bool hasGraphicProvider() const;
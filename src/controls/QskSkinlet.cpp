@@ -228,7 +228,7 @@ static inline QSGNode* qskUpdateBoxNode(
 }
 
 static inline QSGNode* qskUpdateArcNode(
-    const QskSkinnable*, QSGNode* node, const QRectF& rect,
+    const QskSkinnable* skinnable, QSGNode* node, const QRectF& rect,
     qreal borderWidth, const QColor borderColor,
     const QskGradient& gradient, const QskArcMetrics& metrics )
 {
@@ -239,7 +239,8 @@ static inline QSGNode* qskUpdateArcNode(
         return nullptr;
 
     auto arcNode = QskSGNode::ensureNode< QskArcNode >( node );
-    arcNode->setArcData( rect, metrics, borderWidth, borderColor, gradient );
+    arcNode->setArcData( qskWindowOfSkinnable( skinnable ),
+        rect, metrics, borderWidth, borderColor, gradient );
 
     return arcNode;
 }
@@ -844,6 +845,11 @@ QskAspect::States QskSkinlet::sampleStates(
     return skinnable->skinStates();
 }
 
+void QskSkinlet::collectMeasurements(
+    const QskSkinnable*, Measurements& ) const
+{
+}
+
 QVariant QskSkinlet::sampleAt( const QskSkinnable*,
     QskAspect::Subcontrol, int index ) const
 {
@@ -12,7 +12,9 @@
 #include <qnamespace.h>
 #include <qrect.h>
 
+#include <functional>
 #include <memory>
+#include <vector>
 
 class QskArcMetrics;
 class QskSkin;
@@ -45,6 +47,15 @@ class QSK_EXPORT QskSkinlet
     virtual QSizeF sizeHint( const QskSkinnable*,
         Qt::SizeHint, const QSizeF& ) const;
 
+    using Measurements = std::vector< std::function< void() > >;
+
+    /*
+        Appends jobs, that precalculate the expensive parts of sizeHint()
+        ( f.e. text sizes ) into shared caches. The jobs must not access
+        the skinnable and might be executed from any thread.
+     */
+    virtual void collectMeasurements( const QskSkinnable*, Measurements& ) const;
+
     virtual QRectF subControlRect( const QskSkinnable*,
         const QRectF&, QskAspect::Subcontrol ) const;
 
@@ -17,6 +17,7 @@
 #include "QskSkinHintTable.h"
 #include "QskSkinTransition.h"
 #include "QskSkinlet.h"
+#include "QskSubcontrolLayoutCache.h"
 #include "QskWindow.h"
 
 #include "QskBoxShapeMetrics.h"
@@ -158,6 +159,16 @@ static inline void qskTriggerUpdates( QskAspect aspect, QQuickItem* item )
     if ( control == nullptr )
         return;
 
+    if ( !aspect.isColor() )
+    {
+        /*
+            Not all of these aspects reset the implicit size, but
+            the layout of the subcontrols might be affected anyway
+         */
+        if ( auto cache = qskSubcontrolLayoutCache( control, false ) )
+            cache->clear();
+    }
+
     bool maybeLayout = false;
 
     switch( aspect.type() )
@@ -732,6 +743,24 @@ QskFontRole QskSkinnable::fontRoleHint(
         aspect | QskAspect::FontRole, status ).value< QskFontRole >();
 }
 
+static inline int qskAnimatedFontSize(
+    const QskSkinnable* skinnable, const QskFontRole& fontRole )
+{
+    if ( auto item = skinnable->owningItem() )
+    {
+        const auto v = QskSkinTransition::animatedFontSize(
+            item->window(), fontRole );
+
+        if ( v.canConvert< int >() )
+        {
+            item->update(); // design flaw: see effectiveGraphicFilter
+            return v.value< int >();
+        }
+    }
+
+    return -1;
+}
+
 QFont QskSkinnable::effectiveFont( QskAspect aspect ) const
 {
     const auto hint = effectiveSkinHint( aspect | QskAspect::FontRole );
@@ -749,25 +778,28 @@ QFont QskSkinnable::effectiveFont( QskAspect aspect ) const
 
     auto font = effectiveSkin()->font( fontRole );
 
-    if ( auto item = owningItem() )
-    {
-        const auto v = QskSkinTransition::animatedFontSize(
-            item->window(), fontRole );
-
-        if ( v.canConvert< int >() )
-        {
-            font.setPixelSize( v.value< int >() );
-            item->update(); // design flaw: see effectiveGraphicFilter
-        }
-    }
+    const auto pixelSize = qskAnimatedFontSize( this, fontRole );
+    if ( pixelSize > 0 )
+        font.setPixelSize( pixelSize );
 
     return font;
 }
 
 qreal QskSkinnable::effectiveFontHeight( const QskAspect aspect ) const
 {
-    const QFontMetricsF fm( effectiveFont( aspect ) );
-    return fm.height();
+    const auto hint = effectiveSkinHint( aspect | QskAspect::FontRole );
+    if ( hint.canConvert< QFont >() )
+    {
+        const QFontMetricsF fm( hint.value< QFont >() );
+        return fm.height();
+    }
+
+    // the skin caches the metrics of its fonts
+
+    const auto fontRole = hint.value< QskFontRole >();
+    const auto pixelSize = qskAnimatedFontSize( this, fontRole );
+
+    return effectiveSkin()->fontMetrics( fontRole, pixelSize ).height;
 }
 
 bool QskSkinnable::setGraphicRoleHint( const QskAspect aspect, int role )
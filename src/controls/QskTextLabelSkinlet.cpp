@@ -145,4 +145,27 @@ QSizeF QskTextLabelSkinlet::sizeHint( const QskSkinnable* skinnable,
     return hint;
 }
 
+void QskTextLabelSkinlet::collectMeasurements(
+    const QskSkinnable* skinnable, Measurements& measurements ) const
+{
+    const auto label = static_cast< const QskTextLabel* >( skinnable );
+
+    const auto text = label->text();
+    if ( text.isEmpty() )
+        return;
+
+    auto textOptions = label->textOptions();
+    textOptions.setFormat( label->effectiveTextFormat() );
+
+    // QTextDocument is not made for being used from worker threads
+    if ( textOptions.effectiveFormat( text ) != QskTextOptions::PlainText )
+        return;
+
+    const auto font = label->effectiveFont( QskTextLabel::Text );
+
+    // the unconstrained size, as being requested from sizeHint()
+    measurements.push_back( [ text, font, textOptions ]()
+        { QskTextRenderer::textSize( text, font, textOptions ); } );
+}
+
 #include "moc_QskTextLabelSkinlet.cpp"
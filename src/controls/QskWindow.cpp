@@ -10,10 +10,14 @@
 #include "QskSetup.h"
 #include "QskSkin.h"
 #include "QskSkinManager.h"
+#include "QskSizeHintCache.h"
 #include "QskInternalMacros.h"
 
 #include <qmath.h>
 #include <qpointer.h>
+#include <qvarlengtharray.h>
+
+#include <algorithm>
 
 QSK_QT_PRIVATE_BEGIN
 #include <private/qquickitem_p.h>
@@ -133,6 +137,16 @@ static inline const QByteArray& qskVisualizationMode( const QQuickWindow* window
 #endif
 }
 
+static inline int qskItemDepth( const QQuickItem* item )
+{
+    int depth = 0;
+
+    for ( auto parent = item->parentItem(); parent; parent = parent->parentItem() )
+        depth++;
+
+    return depth;
+}
+
 class QskWindowPrivate : public QQuickWindowPrivate
 {
     Q_DECLARE_PUBLIC( QskWindow )
@@ -145,7 +159,76 @@ class QskWindowPrivate : public QQuickWindowPrivate
         , deleteOnClose( false )
         , autoLayoutChildren( true )
         , showedOnce( false )
+        , layoutScheduling( true )
+        , isPolishing( false )
+    {
+    }
+
+    bool aboutToPolish( QQuickItem* item )
+    {
+        if ( !isPolishing )
+        {
+            // the first item of a polish cycle
+            isPolishing = true;
+
+            layoutStatistics = QskWindow::LayoutStatistics();
+            measuredHints = QskSizeHintCache::statistics().misses;
+
+            if ( layoutScheduling && !itemsToPolish.isEmpty() )
+            {
+                const int depth = qskItemDepth( item );
+
+                const bool postpone = std::any_of(
+                    itemsToPolish.cbegin(), itemsToPolish.cend(),
+                    [depth]( const QQuickItem* other )
+                    { return qskItemDepth( other ) < depth; } );
+
+                if ( postpone )
+                    item->polish(); // appended to itemsToPolish
+
+                sortItemsToPolish();
+
+                if ( postpone )
+                    return false;
+            }
+        }
+
+        layoutStatistics.polishedItems++;
+        return true;
+    }
+
+    void polishingFinished()
     {
+        if ( isPolishing )
+        {
+            isPolishing = false;
+
+            layoutStatistics.measuredHints =
+                QskSizeHintCache::statistics().misses - measuredHints;
+        }
+    }
+
+    void sortItemsToPolish()
+    {
+        /*
+            QQuickWindowPrivate::polishItems takes the items from the end
+            of the list. Items, that are scheduled while polishing are
+            appended and are children of the item being polished usually.
+            So sorting the list once is good enough to have top/down order.
+         */
+        QVarLengthArray< QPair< int, QQuickItem* >, 64 > items;
+        items.reserve( itemsToPolish.size() );
+
+        for ( auto item : std::as_const( itemsToPolish ) )
+            items += qMakePair( qskItemDepth( item ), item );
+
+        std::stable_sort( items.begin(), items.end(),
+            []( const QPair< int, QQuickItem* >& item1,
+                const QPair< int, QQuickItem* >& item2 )
+            { return item1.first > item2.first; } );
+
+        for ( int i = 0; i < items.size(); i++ )
+            itemsToPolish[i] = items[i].second;
     }
 
 #ifdef QSK_DEBUG_RENDER_TIMING
@@ -162,10 +245,15 @@ class QskWindowPrivate : public QQuickWindowPrivate
 
     QskWindow::EventAcceptance eventAcceptance;
 
+    QskWindow::LayoutStatistics layoutStatistics;
+    quint64 measuredHints = 0;
+
     bool explicitLocale : 1;
     bool deleteOnClose : 1;
     bool autoLayoutChildren : 1;
     bool showedOnce : 1;
+    bool layoutScheduling : 1;
+    bool isPolishing : 1;
 };
 
 QskWindow::QskWindow( QWindow* parent )
@@ -193,6 +281,10 @@ QskWindow::QskWindow( QWindow* parent )
 
     d_func()->contentItemListener.setEnabled( contentItem(), true );
 
+    // emitted after QQuickWindowPrivate::polishItems
+    connect( this, &QQuickWindow::afterAnimating,
+        this, [ this ]() { d_func()->polishingFinished(); } );
+
     if ( !qskEnforcedSkin )
         connect( this, &QQuickWindow::afterAnimating, this, &QskWindow::enforceSkin );
 }
@@ -285,7 +377,24 @@ void QskWindow::addItem( QQuickItem* item )
 void QskWindow::polishItems()
 {
     Q_D( QskWindow );
+
     d->polishItems();
+    d->polishingFinished();
+}
+
+void QskWindow::setLayoutScheduling( bool on )
+{
+    d_func()->layoutScheduling = on;
+}
+
+bool QskWindow::layoutScheduling() const
+{
+    return d_func()->layoutScheduling;
+}
+
+QskWindow::LayoutStatistics QskWindow::layoutStatistics() const
+{
+    return d_func()->layoutStatistics;
 }
 
 bool QskWindow::event( QEvent* event )
@@ -485,6 +594,21 @@ void QskWindow::resetLocale()
 
 QSK_HIDDEN_EXTERNAL_BEGIN
 
+bool qskAboutToPolish( QQuickItem* item )
+{
+    /*
+        Called from QskItem::updatePolish. Returns false, when the item
+        has been postponed, because items above have to be polished first.
+     */
+    if ( auto window = qobject_cast< QskWindow* >( item->window() ) )
+    {
+        auto d = static_cast< QskWindowPrivate* >( QQuickWindowPrivate::get( window ) );
+        return d->aboutToPolish( item );
+    }
+
+    return true;
+}
+
 bool qskInheritLocale( QskWindow* window, const QLocale& locale )
 {
     auto d = static_cast< QskWindowPrivate* >( QQuickWindowPrivate::get( window ) );
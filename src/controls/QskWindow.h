@@ -35,6 +35,16 @@ class QSK_EXPORT QskWindow : public QQuickWindow
         EventPropagationStopped = 1
     };
 
+    class LayoutStatistics
+    {
+      public:
+        // number of QskItem::updatePolish calls
+        int polishedItems = 0;
+
+        // size hints, that had to be calculated ( see QskSizeHintCache )
+        quint64 measuredHints = 0;
+    };
+
     QskWindow( QWindow* parent = nullptr );
     QskWindow( QQuickRenderControl* renderControl, QWindow* parent = nullptr );
 
@@ -63,6 +73,20 @@ class QSK_EXPORT QskWindow : public QQuickWindow
 
     void polishItems();
 
+    /*
+        Qt/Quick polishes the items in an undefined order, so that
+        a box might be layouted before its parent has assigned its
+        final geometry - and again after it has been resized.
+
+        With layout scheduling enabled ( default ) the items being
+        scheduled for polishing are processed in top/down order.
+     */
+    void setLayoutScheduling( bool );
+    bool layoutScheduling() const;
+
+    // statistics of the most recent polish cycle
+    LayoutStatistics layoutStatistics() const;
+
     void setCustomRenderMode( const char* mode );
     const char* customRenderMode() const;
 
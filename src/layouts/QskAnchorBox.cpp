@@ -0,0 +1,689 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) The authors
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#include "QskAnchorBox.h"
+#include "QskEvent.h"
+#include "QskQuick.h"
+
+#include "kiwi/Solver.h"
+#include "kiwi/Constraint.h"
+#include "kiwi/Variable.h"
+#include "kiwi/Expression.h"
+
+#include <qcoreapplication.h>
+
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <vector>
+
+using namespace QskKiwi;
+
+static inline Qt::Orientation qskOrientation( int edge )
+{
+    return ( edge <= Qt::AnchorRight ) ? Qt::Horizontal : Qt::Vertical;
+}
+
+static inline Qt::AnchorPoint qskAnchorPoint(
+    Qt::Corner corner, Qt::Orientation orientation )
+{
+    if ( orientation == Qt::Horizontal )
+        return ( corner & 0x1 ) ? Qt::AnchorRight : Qt::AnchorLeft;
+    else
+        return ( corner >= 0x2 ) ? Qt::AnchorBottom : Qt::AnchorTop;
+}
+
+static void qskSetItemActive( QObject* receiver, const QQuickItem* item, bool on )
+{
+    /*
+        For QQuickItems not being derived from QskControl we manually
+        send QEvent::LayoutRequest events.
+     */
+
+    if ( qskControlCast( item ) )
+        return;
+
+    if ( on )
+    {
+        auto sendLayoutRequest =
+            [receiver]()
+            {
+                QEvent event( QEvent::LayoutRequest );
+                QCoreApplication::sendEvent( receiver, &event );
+            };
+
+        QObject::connect( item, &QQuickItem::implicitWidthChanged,
+            receiver, sendLayoutRequest );
+
+        QObject::connect( item, &QQuickItem::implicitHeightChanged,
+            receiver, sendLayoutRequest );
+    }
+    else
+    {
+        QObject::disconnect( item, &QQuickItem::implicitWidthChanged, receiver, nullptr );
+        QObject::disconnect( item, &QQuickItem::implicitHeightChanged, receiver, nullptr );
+    }
+}
+
+namespace
+{
+    class Geometry
+    {
+      public:
+        Expression expressionAt( int anchorPoint ) const
+        {
+            switch( anchorPoint )
+            {
+                case Qt::AnchorLeft:
+                    return Term( m_left );
+
+                case Qt::AnchorHorizontalCenter:
+                    return centerH();
+
+                case Qt::AnchorRight:
+                    return right();
+
+                case Qt::AnchorTop:
+                    return Term( m_top );
+
+                case Qt::AnchorVerticalCenter:
+                    return centerV();
+
+                case Qt::AnchorBottom:
+                    return bottom();
+            }
+
+            return Expression();
+        }
+
+        inline const Variable& length( Qt::Orientation orientation ) const
+        {
+            return ( orientation == Qt::Horizontal ) ? m_width : m_height;
+        }
+
+        inline QRectF rect() const
+        {
+            return QRectF( m_left.value(), m_top.value(),
+                m_width.value(), m_height.value() );
+        }
+
+        inline Expression centerH() const { return m_left + 0.5 * m_width; }
+        inline Expression centerV() const { return m_top + 0.5 * m_height; }
+        inline Expression right() const { return m_left + m_width; }
+        inline Expression bottom() const { return m_top + m_height; }
+
+        inline const Variable& width() const { return m_width; }
+        inline const Variable& height() const { return m_height; }
+
+      private:
+        Variable m_left, m_top, m_width, m_height;
+    };
+
+    class Element
+    {
+      public:
+        Geometry geometry;
+
+        // the hints, the size constraints have been created from
+        QSizeF hints[ 3 ];
+        std::vector< Constraint > constraints;
+    };
+
+    class Anchor
+    {
+      public:
+        QQuickItem* item1 = nullptr;
+        Qt::AnchorPoint edge1;
+
+        QQuickItem* item2 = nullptr;
+        Qt::AnchorPoint edge2;
+
+        /*
+            Anchors to the box are referring to the size of the
+            box, that is different for each solver. So we need
+            to have individual constraints for them.
+         */
+        Constraint hintConstraint;
+        Constraint layoutConstraint;
+
+        // only for anchors between children, and only for the layout
+        Constraint stretchConstraint;
+    };
+
+    class LayoutSolver : public Solver
+    {
+      public:
+        LayoutSolver()
+        {
+            setEditable( true );
+        }
+
+        Expression expressionAt( Qt::AnchorPoint anchorPoint ) const
+        {
+            switch( anchorPoint )
+            {
+                case Qt::AnchorHorizontalCenter:
+                    return Term( 0.5 * m_width );
+
+                case Qt::AnchorRight:
+                    return Term( m_width );
+
+                case Qt::AnchorVerticalCenter:
+                    return Term( 0.5 * m_height );
+
+                case Qt::AnchorBottom:
+                    return Term( m_height );
+
+                default:
+                    return Expression( 0.0 );
+            }
+        }
+
+        void setEditable( bool on )
+        {
+            if ( on == hasEditVariable( m_width ) )
+                return;
+
+            if ( on )
+            {
+                const double strength = 0.9 * Strength::required;
+
+                addEditVariable( m_width, strength );
+                addEditVariable( m_height, strength );
+            }
+            else
+            {
+                removeEditVariable( m_width );
+                removeEditVariable( m_height );
+            }
+        }
+
+        void resolve( qreal width, qreal height )
+        {
+            /*
+                The edit variables stay in the solver, so that
+                suggesting a new size only runs the dual optimization
+                starting from the previous solution.
+             */
+            suggestValue( m_width, width );
+            suggestValue( m_height, height );
+
+            updateVariables();
+        }
+
+        QSizeF resolvedSize()
+        {
+            updateVariables();
+            return QSizeF( m_width.value(), m_height.value() );
+        }
+
+        QSizeF resolvedSize( qreal width, qreal height )
+        {
+            resolve( width, height );
+            return QSizeF( m_width.value(), m_height.value() );
+        }
+
+      private:
+        Variable m_width, m_height;
+    };
+}
+
+class QskAnchorBox::PrivateData
+{
+  public:
+    Element& element( QQuickItem* item )
+    {
+        auto it = elements.find( item );
+        if ( it == elements.end() )
+        {
+            it = elements.emplace( item, Element() ).first;
+            updateSizeConstraints( item, it->second );
+        }
+
+        return it->second;
+    }
+
+    void addAnchor( Anchor& anchor )
+    {
+        const auto& r1 = element( anchor.item1 ).geometry;
+        const auto expr1 = r1.expressionAt( anchor.edge1 );
+
+        if ( anchor.item2 == nullptr )
+        {
+            anchor.hintConstraint =
+                ( expr1 == hintSolver.expressionAt( anchor.edge2 ) );
+
+            anchor.layoutConstraint =
+                ( expr1 == layoutSolver.expressionAt( anchor.edge2 ) );
+        }
+        else
+        {
+            const auto& r2 = element( anchor.item2 ).geometry;
+
+            anchor.hintConstraint = ( expr1 == r2.expressionAt( anchor.edge2 ) );
+            anchor.layoutConstraint = anchor.hintConstraint;
+
+            /*
+                A constraint with medium strength to make anchored item
+                being stretched according to their stretch factors s1, s2.
+                ( For the moment we don't support having specific factors. )
+             */
+            const auto o = qskOrientation( anchor.edge1 );
+
+            const auto s1 = 1.0;
+            const auto s2 = 1.0;
+
+            anchor.stretchConstraint = Constraint(
+                r1.length( o ) * s1 == r2.length( o ) * s2, Strength::medium );
+
+            layoutSolver.addConstraint( anchor.stretchConstraint );
+        }
+
+        hintSolver.addConstraint( anchor.hintConstraint );
+        layoutSolver.addConstraint( anchor.layoutConstraint );
+    }
+
+    void removeAnchor( const Anchor& anchor )
+    {
+        hintSolver.removeConstraint( anchor.hintConstraint );
+        layoutSolver.removeConstraint( anchor.layoutConstraint );
+
+        if ( !!anchor.stretchConstraint )
+            layoutSolver.removeConstraint( anchor.stretchConstraint );
+    }
+
+    bool updateSizeConstraints( const QQuickItem* item, Element& element )
+    {
+        QSizeF hints[ 3 ];
+        for ( int i = Qt::MinimumSize; i <= Qt::MaximumSize; i++ )
+            hints[ i ] = qskSizeConstraint( item, static_cast< Qt::SizeHint >( i ) );
+
+        if ( !element.constraints.empty()
+            && std::equal( hints, hints + 3, element.hints ) )
+        {
+            return false;
+        }
+
+        for ( const auto& constraint : element.constraints )
+        {
+            hintSolver.removeConstraint( constraint );
+            layoutSolver.removeConstraint( constraint );
+        }
+
+        element.constraints.clear();
+
+        addSizeConstraints( element, hints[ Qt::MinimumSize ], OP_GE, Strength::required );
+        addSizeConstraints( element, hints[ Qt::MaximumSize ], OP_LE, Strength::required );
+        addSizeConstraints( element, hints[ Qt::PreferredSize ], OP_EQ, Strength::strong );
+
+        for ( const auto& constraint : element.constraints )
+        {
+            hintSolver.addConstraint( constraint );
+            layoutSolver.addConstraint( constraint );
+        }
+
+        std::copy( hints, hints + 3, element.hints );
+
+        return true;
+    }
+
+    void updateHints()
+    {
+        /*
+             The solver seems to run into overflows with
+             std::numeric_limits< unsigned float >::max()
+         */
+        const qreal max = std::numeric_limits< unsigned int >::max();
+
+        hintSolver.setEditable( false );
+        hints[ Qt::PreferredSize ] = hintSolver.resolvedSize();
+
+        hintSolver.setEditable( true );
+        hints[ Qt::MinimumSize ] = hintSolver.resolvedSize( 0.0, 0.0 );
+        hints[ Qt::MaximumSize ] = hintSolver.resolvedSize( max, max );
+
+        hasValidHints = true;
+    }
+
+    std::map< QQuickItem*, Element > elements;
+    std::vector< Anchor > anchors;
+
+    /*
+        The hints are calculated without the stretch constraints,
+        the layout is done with them. Both solvers are kept alive
+        and are modified incrementally.
+     */
+    LayoutSolver hintSolver;
+    LayoutSolver layoutSolver;
+
+    QSizeF hints[ 3 ];
+    bool hasValidHints = false;
+
+    bool blockAutoRemove = false;
+
+  private:
+    void addSizeConstraints( Element& element, const QSizeF& size,
+        RelationalOperator op, double strength )
+    {
+        const auto& r = element.geometry;
+
+        if ( size.width() >= 0.0 )
+            element.constraints.emplace_back( r.width() - size.width(), op, strength );
+
+        if ( size.height() >= 0.0 )
+            element.constraints.emplace_back( r.height() - size.height(), op, strength );
+    }
+};
+
+QskAnchorBox::QskAnchorBox( QQuickItem* parent )
+    : Inherited( false, parent )
+    , m_data( new PrivateData )
+{
+}
+
+QskAnchorBox::~QskAnchorBox()
+{
+    for ( const auto& element : m_data->elements )
+        qskSetItemActive( this, element.first, false );
+}
+
+void QskAnchorBox::addAnchors( QQuickItem* item, Qt::Orientations orientations )
+{
+    addAnchors( item, this, orientations );
+}
+
+void QskAnchorBox::addAnchors( QQuickItem* item1,
+    QQuickItem* item2, Qt::Orientations orientations )
+{
+    if ( orientations & Qt::Horizontal )
+    {
+        addAnchor( item1, Qt::AnchorLeft, item2, Qt::AnchorLeft );
+        addAnchor( item1, Qt::AnchorRight, item2, Qt::AnchorRight );
+    }
+
+    if ( orientations & Qt::Vertical )
+    {
+        addAnchor( item1, Qt::AnchorTop, item2, Qt::AnchorTop );
+        addAnchor( item1, Qt::AnchorBottom, item2, Qt::AnchorBottom );
+    }
+}
+
+void QskAnchorBox::addAnchors( QQuickItem* item, Qt::Corner corner )
+{
+    addAnchors( item, corner, this, corner );
+}
+
+void QskAnchorBox::addAnchors( QQuickItem* item1,
+    Qt::Corner corner1, QQuickItem* item2, Qt::Corner corner2 )
+{
+    addAnchor( item1, qskAnchorPoint( corner1, Qt::Horizontal ),
+        item2, qskAnchorPoint( corner2, Qt::Horizontal ) );
+
+    addAnchor( item1, qskAnchorPoint( corner1, Qt::Vertical ),
+        item2, qskAnchorPoint( corner2, Qt::Vertical ) );
+}
+
+void QskAnchorBox::addAnchor( QQuickItem* item,
+    Qt::AnchorPoint edge1, Qt::AnchorPoint edge2 )
+{
+    addAnchor( item, edge1, this, edge2 );
+}
+
+void QskAnchorBox::addAnchor( QQuickItem* item1, Qt::AnchorPoint edge1,
+    QQuickItem* item2, Qt::AnchorPoint edge2 )
+{
+    if ( item1 == item2 || item1 == nullptr || item2 == nullptr )
+        return;
+
+    if ( item1 == this )
+    {
+        std::swap( item1, item2 );
+        std::swap( edge1, edge2 );
+    }
+
+    if ( item2 == this )
+        item2 = nullptr;
+
+    if ( qskOrientation( edge1 ) != qskOrientation( edge2 ) )
+        return;
+
+    for ( auto item : { item1, item2 } )
+    {
+        if ( item == nullptr || m_data->elements.count( item ) )
+            continue;
+
+        if ( item->parent() == nullptr )
+            item->setParent( this );
+
+        if ( item->parentItem() != this )
+            item->setParentItem( this );
+
+        qskSetItemActive( this, item, true );
+    }
+
+    Anchor anchor;
+    anchor.item1 = item1;
+    anchor.edge1 = edge1;
+    anchor.item2 = item2;
+    anchor.edge2 = edge2;
+
+    m_data->addAnchor( anchor );
+    m_data->anchors.push_back( anchor );
+
+    m_data->hasValidHints = false;
+
+    resetImplicitSize();
+    polish();
+}
+
+void QskAnchorBox::removeItem( const QQuickItem* item )
+{
+    auto it = m_data->elements.find( const_cast< QQuickItem* >( item ) );
+    if ( it == m_data->elements.end() )
+        return;
+
+    auto& anchors = m_data->anchors;
+
+    auto isObsolete =
+        [ this, item ]( const Anchor& anchor )
+        {
+            if ( anchor.item1 == item || anchor.item2 == item )
+            {
+                m_data->removeAnchor( anchor );
+                return true;
+            }
+
+            return false;
+        };
+
+    anchors.erase( std::remove_if( anchors.begin(), anchors.end(), isObsolete ),
+        anchors.end() );
+
+    for ( const auto& constraint : it->second.constraints )
+    {
+        m_data->hintSolver.removeConstraint( constraint );
+        m_data->layoutSolver.removeConstraint( constraint );
+    }
+
+    m_data->elements.erase( it );
+
+    qskSetItemActive( this, item, false );
+
+    m_data->hasValidHints = false;
+
+    resetImplicitSize();
+    polish();
+}
+
+void QskAnchorBox::clear( bool autoDelete )
+{
+    m_data->blockAutoRemove = true;
+
+    for ( const auto& element : m_data->elements )
+    {
+        auto item = element.first;
+
+        qskSetItemActive( this, item, false );
+
+        if( autoDelete && ( item->parent() == this ) )
+            delete item;
+        else
+            item->setParentItem( nullptr );
+    }
+
+    m_data->blockAutoRemove = false;
+
+    m_data->elements.clear();
+    m_data->anchors.clear();
+
+    /*
+        The solvers keep the variables of removed constraints,
+        so we better start from scratch
+     */
+    m_data->hintSolver.reset();
+    m_data->hintSolver.setEditable( true );
+
+    m_data->layoutSolver.reset();
+    m_data->layoutSolver.setEditable( true );
+
+    m_data->hasValidHints = false;
+
+    resetImplicitSize();
+    polish();
+}
+
+int QskAnchorBox::elementCount() const
+{
+    return static_cast< int >( m_data->elements.size() );
+}
+
+int QskAnchorBox::anchorCount() const
+{
+    return static_cast< int >( m_data->anchors.size() );
+}
+
+void QskAnchorBox::geometryChangeEvent( QskGeometryChangeEvent* event )
+{
+    Inherited::geometryChangeEvent( event );
+
+    if ( event->isResized() )
+        polish();
+}
+
+void QskAnchorBox::itemChange( ItemChange change, const ItemChangeData& value )
+{
+    Inherited::itemChange( change, value );
+
+    switch ( change )
+    {
+        case ItemChildRemovedChange:
+        {
+            if ( !m_data->blockAutoRemove )
+                removeItem( value.item );
+            break;
+        }
+        case QQuickItem::ItemVisibleHasChanged:
+        {
+            if ( value.boolValue )
+                polish();
+            break;
+        }
+        case QQuickItem::ItemSceneChange:
+        {
+            if ( value.window )
+                polish();
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+bool QskAnchorBox::event( QEvent* event )
+{
+    switch ( static_cast< int >( event->type() ) )
+    {
+        case QEvent::LayoutRequest:
+        {
+            /*
+                Usually the size hints of one of the children have changed.
+                Only the size constraints of the modified children are
+                replaced, and as long as this does not affect the hints
+                of the box we don't need to bother our parent.
+             */
+            bool hasChanged = false;
+
+            for ( auto& element : m_data->elements )
+            {
+                if ( m_data->updateSizeConstraints( element.first, element.second ) )
+                    hasChanged = true;
+            }
+
+            if ( hasChanged )
+            {
+                if ( m_data->hasValidHints )
+                {
+                    const QSizeF oldHints[] = { m_data->hints[ 0 ],
+                        m_data->hints[ 1 ], m_data->hints[ 2 ] };
+
+                    m_data->updateHints();
+
+                    if ( !std::equal( oldHints, oldHints + 3, m_data->hints ) )
+                        resetImplicitSize();
+                }
+                else
+                {
+                    resetImplicitSize();
+                }
+            }
+
+            polish();
+            break;
+        }
+        case QEvent::ContentsRectChange:
+        {
+            polish();
+            break;
+        }
+    }
+
+    return Inherited::event( event );
+}
+
+void QskAnchorBox::updateLayout()
+{
+    if ( !maybeUnresized() )
+        updateGeometries( layoutRect() );
+}
+
+QSizeF QskAnchorBox::layoutSizeHint(
+    Qt::SizeHint which, const QSizeF& constraint ) const
+{
+    if ( constraint.width() >= 0.0 || constraint.height() >= 0.0 )
+    {
+        // TODO ...
+        return QSizeF();
+    }
+
+    if ( !m_data->hasValidHints )
+        m_data->updateHints();
+
+    return m_data->hints[ which ];
+}
+
+void QskAnchorBox::updateGeometries( const QRectF& rect )
+{
+    m_data->layoutSolver.resolve( rect.width(), rect.height() );
+
+    for ( const auto& element : m_data->elements )
+    {
+        auto r = element.second.geometry.rect();
+        r.translate( rect.left(), rect.top() );
+
+        qskSetItemGeometry( element.first, r );
+    }
+}
+
+#include "moc_QskAnchorBox.cpp"
@@ -3,19 +3,30 @@
  *           SPDX-License-Identifier: BSD-3-Clause
  *****************************************************************************/
 
-#pragma once
+#ifndef QSK_ANCHOR_BOX_H
+#define QSK_ANCHOR_BOX_H
 
-#include "QskControl.h"
+#include "QskBox.h"
 
-class AnchorBox : public QskControl
+/*
+    A layout, that positions its children according to anchors between
+    the edges of the children and/or the box itself.
+
+    The anchors are translated into the constraints of a Cassowary
+    solver, that is kept alive and updated incrementally: adding/removing
+    anchors or children and changing the size hints of children only
+    modifies the affected constraints, while resizing the box
+    is done by suggesting new values for the size of the box.
+ */
+class QSK_EXPORT QskAnchorBox : public QskBox
 {
     Q_OBJECT
 
-    using Inherited = QskControl;
+    using Inherited = QskBox;
 
   public:
-    AnchorBox( QQuickItem* parent = nullptr );
-    ~AnchorBox() override;
+    QskAnchorBox( QQuickItem* parent = nullptr );
+    ~QskAnchorBox() override;
 
     // anchoring to the box
     void addAnchor( QQuickItem*, Qt::AnchorPoint, Qt::AnchorPoint );
@@ -28,16 +39,34 @@ class AnchorBox : public QskControl
     void addAnchors( QQuickItem*, QQuickItem*,
         Qt::Orientations = Qt::Horizontal | Qt::Vertical );
 
+    // removing the item and all anchors it is involved in
+    void removeItem( const QQuickItem* );
+    void clear( bool autoDelete = false );
+
+    int elementCount() const;
+    bool isEmpty() const;
+
+    int anchorCount() const;
+
   protected:
+    bool event( QEvent* ) override;
+
     void geometryChangeEvent( QskGeometryChangeEvent* ) override;
-    void updateLayout() override;
+    void itemChange( ItemChange, const ItemChangeData& ) override;
 
+    void updateLayout() override;
     QSizeF layoutSizeHint( Qt::SizeHint, const QSizeF& ) const override;
 
   private:
-    void updateHints();
     void updateGeometries( const QRectF& );
 
     class PrivateData;
     std::unique_ptr< PrivateData > m_data;
 };
+
+inline bool QskAnchorBox::isEmpty() const
+{
+    return elementCount() <= 0;
+}
+
+#endif
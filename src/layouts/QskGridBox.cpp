@@ -463,7 +463,15 @@ bool QskGridBox::event( QEvent* event )
     {
         case QEvent::LayoutRequest:
         {
-            invalidate();
+            /*
+                Usually the size hints of one of the children have changed.
+                As long as this does not affect the hints of the box
+                we don't need to bother our parent.
+             */
+            if ( m_data->engine.updateHints() )
+                resetImplicitSize();
+
+            polish();
             break;
         }
         case QEvent::LayoutDirectionChange:
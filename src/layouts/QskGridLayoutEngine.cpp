@@ -170,161 +170,93 @@ namespace
         return layoutItem.metrics( orientation, constraint );
     }
 
-    class Element
+    inline QRect qskMinimumGrid( const QRect& grid )
     {
-      public:
-        Element( QQuickItem*, const QRect& );
-        Element( const QSizeF& spacing, const QRect& );
-        Element( const Element& );
-
-        Element& operator=( const Element& );
-
-        QSizeF spacing() const;
-        QQuickItem* item() const;
-
-        QRect grid() const;
-        void setGrid( const QRect& );
+        return QRect( grid.left(), grid.top(),
+            qMax( grid.width(), 1 ), qMax( grid.height(), 1 ) );
+    }
 
-        QRect minimumGrid() const;
+    /*
+        The elements are stored as structure of arrays, so that
+        setting up the chains runs over contiguous memory
+        instead of chasing pointers.
+     */
+    class Elements
+    {
+      public:
+        inline int count() const { return grids.count(); }
 
-        bool isIgnored() const;
-        QskLayoutChain::CellData cell( Qt::Orientation ) const;
+        inline bool isValidIndex( int index ) const
+        {
+            return ( index >= 0 ) && ( index < grids.count() );
+        }
 
-        void transpose();
+        void append( QQuickItem* item, const QSizeF& spacing, const QRect& grid )
+        {
+            items += item;
+            spacings += spacing;
+            grids += grid;
+        }
 
-      private:
+        void removeAt( int index )
+        {
+            items.remove( index );
+            spacings.remove( index );
+            grids.remove( index );
+        }
 
-        union
+        void clear()
         {
-            QQuickItem* m_item;
-            QSizeF m_spacing;
-        };
+            items.clear();
+            spacings.clear();
+            grids.clear();
+        }
 
-        QRect m_grid;
-        bool m_isSpacer;
+        QVector< QQuickItem* > items; // nullptr for spacers
+        QVector< QSizeF > spacings;
+        QVector< QRect > grids; // as being set, not the effective ones
     };
 
-    class ElementsVector : public std::vector< Element >
+    /*
+        Data derived from the elements, that is valid until
+        the next invalidate( ElementCache ).
+     */
+    class ElementData
     {
       public:
-        // to avoid warnings when assigning size_t to int
-        inline int count() const { return static_cast< int >( size() ); }
-    };
-}
-
-Element::Element( QQuickItem* item, const QRect& grid )
-    : m_item( item )
-    , m_grid( grid )
-    , m_isSpacer( false )
-{
-}
-
-Element::Element( const QSizeF& spacing, const QRect& grid )
-    : m_spacing( spacing )
-    , m_grid( grid )
-    , m_isSpacer( true )
-{
-}
-
-Element::Element( const Element& other )
-    : m_grid( other.m_grid )
-    , m_isSpacer (other.m_isSpacer )
-{
-    if ( other.m_isSpacer )
-        m_spacing = other.m_spacing;
-    else
-        m_item = other.m_item;
-}
-
-Element& Element::operator=( const Element& other )
-{
-    m_isSpacer = other.m_isSpacer;
-
-    if ( other.m_isSpacer )
-        m_spacing = other.m_spacing;
-    else
-        m_item = other.m_item;
-
-    m_grid = other.m_grid;
-
-    return *this;
-}
-
-inline QSizeF Element::spacing() const
-{
-    return m_isSpacer ? m_spacing : QSizeF();
-}
-
-inline QQuickItem* Element::item() const
-{
-    return m_isSpacer ? nullptr : m_item;
-}
-
-QRect Element::grid() const
-{
-    return m_grid;
-}
-
-void Element::setGrid( const QRect& grid )
-{
-    m_grid = grid;
-}
-
-QRect Element::minimumGrid() const
-{
-    return QRect( m_grid.left(), m_grid.top(),
-        qMax( m_grid.width(), 1 ), qMax( m_grid.height(), 1 ) );
-}
-
-bool Element::isIgnored() const
-{
-    return !( m_isSpacer || qskIsVisibleToLayout( m_item ) );
-}
-
-QskLayoutChain::CellData Element::cell( Qt::Orientation orientation ) const
-{
-    QskLayoutChain::CellData cell;
-    cell.isValid = true;
+        enum Flag : quint8
+        {
+            Ignored = 1 << 0,
 
-    if ( m_isSpacer )
-    {
-        const qreal value = ( orientation == Qt::Horizontal )
-            ? m_spacing.width() : m_spacing.height();
+            // shifted by 2 for Qt::Vertical
+            CanGrow = 1 << 1,
+            Expanding = 1 << 2
+        };
 
-        cell.metrics.setMinimum( value );
-        cell.metrics.setPreferred( value );
-        cell.metrics.setMaximum( value );
-    }
-    else
-    {
-        const auto policy = qskSizePolicy( m_item ).policy( orientation );
+        static inline int shift( Qt::Orientation orientation )
+        {
+            return ( orientation == Qt::Horizontal ) ? 0 : 2;
+        }
 
-        cell.canGrow = policy & QskSizePolicy::GrowFlag;
+        inline bool hasMetrics( Qt::Orientation orientation ) const
+        {
+            return metricsValid[ orientation - 1 ];
+        }
 
-        if ( policy & QskSizePolicy::ExpandFlag )
-            cell.stretch = 1;
-    }
+        QVector< QRect > effectiveGrids;
+        QVector< quint8 > flags;
 
-    return cell;
-}
+        // the unconstrained hints of the items
+        QVector< QskLayoutMetrics > metrics[2];
+        bool metricsValid[2] = { false, false };
 
-void Element::transpose()
-{
-    m_grid.setRect( m_grid.top(), m_grid.left(),
-        m_grid.height(), m_grid.width() );
+        bool isValid = false;
+    };
 }
 
 class QskGridLayoutEngine::PrivateData
 {
   public:
-    inline Element* elementAt( int index ) const
-    {
-        if ( index < 0 || index >= this->elements.count() )
-            return nullptr;
-
-        return const_cast< Element* >( &this->elements[index] );
-    }
-
     int insertElement( QQuickItem* item, QSizeF spacing, QRect grid )
     {
         // -1 means unlimited, while 0 does not make any sense
@@ -336,7 +268,7 @@ class QskGridLayoutEngine::PrivateData
 
         if ( item )
         {
-            elements.push_back( Element( item, grid ) );
+            spacing = QSizeF();
         }
         else
         {
@@ -345,22 +277,20 @@ class QskGridLayoutEngine::PrivateData
 
             if ( spacing.height() < 0.0 )
                 spacing.setHeight( 0.0 );
-
-            elements.push_back( Element( spacing, grid ) );
         }
 
-        grid = effectiveGrid( elements.back() );
+        elements.append( item, spacing, grid );
+
+        grid = effectiveGrid( grid );
 
         rowCount = qMax( rowCount, grid.bottom() + 1 );
         columnCount = qMax( columnCount, grid.right() + 1 );
 
-        return this->elements.count() - 1;
+        return elements.count() - 1;
     }
 
-    QRect effectiveGrid( const Element& element ) const
+    QRect effectiveGrid( QRect r ) const
     {
-        QRect r = element.grid();
-
         if ( r.width() <= 0 )
             r.setRight( qMax( this->columnCount - 1, r.left() ) );
 
@@ -377,7 +307,107 @@ class QskGridLayoutEngine::PrivateData
             ? that->columnSettings : that->rowSettings;
     }
 
-    ElementsVector elements;
+    const ElementData& elementData() const
+    {
+        if ( !data.isValid )
+        {
+            const int count = elements.count();
+
+            data.effectiveGrids.resize( count );
+            data.flags.resize( count );
+
+            for ( int i = 0; i < count; i++ )
+            {
+                data.effectiveGrids[i] = effectiveGrid( elements.grids[i] );
+
+                quint8 flags = 0;
+
+                if ( auto item = elements.items[i] )
+                {
+                    if ( !qskIsVisibleToLayout( item ) )
+                        flags |= ElementData::Ignored;
+
+                    const auto sizePolicy = qskSizePolicy( item );
+
+                    for ( auto o : { Qt::Horizontal, Qt::Vertical } )
+                    {
+                        const auto policy = sizePolicy.policy( o );
+                        const auto shift = ElementData::shift( o );
+
+                        if ( policy & QskSizePolicy::GrowFlag )
+                            flags |= ElementData::CanGrow << shift;
+
+                        if ( policy & QskSizePolicy::ExpandFlag )
+                            flags |= ElementData::Expanding << shift;
+                    }
+                }
+
+                data.flags[i] = flags;
+            }
+
+            data.metricsValid[0] = data.metricsValid[1] = false;
+            data.isValid = true;
+        }
+
+        return data;
+    }
+
+    const ElementData& elementData( Qt::Orientation orientation ) const
+    {
+        elementData();
+
+        if ( !data.hasMetrics( orientation ) )
+        {
+            const int count = elements.count();
+
+            auto& metrics = data.metrics[ orientation - 1 ];
+            metrics.resize( count );
+
+            for ( int i = 0; i < count; i++ )
+            {
+                auto item = elements.items[i];
+
+                if ( item && !( data.flags[i] & ElementData::Ignored ) )
+                    metrics[i] = qskItemMetrics( item, orientation, -1.0 );
+            }
+
+            data.metricsValid[ orientation - 1 ] = true;
+        }
+
+        return data;
+    }
+
+    QskLayoutChain::CellData cell( int index, Qt::Orientation orientation ) const
+    {
+        QskLayoutChain::CellData cell;
+        cell.isValid = true;
+
+        if ( elements.items[ index ] == nullptr )
+        {
+            const auto& spacing = elements.spacings[ index ];
+
+            const qreal value = ( orientation == Qt::Horizontal )
+                ? spacing.width() : spacing.height();
+
+            cell.metrics.setMinimum( value );
+            cell.metrics.setPreferred( value );
+            cell.metrics.setMaximum( value );
+        }
+        else
+        {
+            const auto flags = data.flags[ index ] >> ElementData::shift( orientation );
+
+            cell.canGrow = flags & ElementData::CanGrow;
+
+            if ( flags & ElementData::Expanding )
+                cell.stretch = 1;
+        }
+
+        return cell;
+    }
+
+    Elements elements;
+    mutable ElementData data;
 
     Settings rowSettings;
     Settings columnSettings;
@@ -480,19 +510,20 @@ int QskGridLayoutEngine::insertItem( QQuickItem* item, const QRect& grid )
 
 int QskGridLayoutEngine::insertSpacer( const QSizeF& spacing, const QRect& grid )
 {
+    invalidate();
     return m_data->insertElement( nullptr, spacing, grid );
 }
 
 bool QskGridLayoutEngine::removeAt( int index )
 {
-    const auto elementAt = m_data->elementAt( index );
-    if ( elementAt == nullptr )
+    auto& elements = m_data->elements;
+
+    if ( !elements.isValidIndex( index ) )
         return false;
 
-    const auto grid = elementAt->minimumGrid();
+    const auto grid = qskMinimumGrid( elements.grids[ index ] );
 
-    auto& elements = m_data->elements;
-    elements.erase( elements.begin() + index );
+    elements.removeAt( index );
 
     // doing a lazy recalculation instead ??
 
@@ -502,9 +533,9 @@ bool QskGridLayoutEngine::removeAt( int index )
         int maxRow = m_data->rowSettings.maxPosition();
         int maxColumn = m_data->columnSettings.maxPosition();
 
-        for ( const auto& element : elements )
+        for ( const auto& elementGrid : std::as_const( elements.grids ) )
         {
-            const auto minGrid = element.minimumGrid();
+            const auto minGrid = qskMinimumGrid( elementGrid );
 
             maxRow = qMax( maxRow, minGrid.bottom() );
             maxColumn = qMax( maxColumn, minGrid.right() );
@@ -534,9 +565,11 @@ int QskGridLayoutEngine::indexAt( int row, int column ) const
 {
     if ( row < m_data->rowCount && column < m_data->columnCount )
     {
-        for ( uint i = 0; i < m_data->elements.size(); i++ )
+        const auto& grids = m_data->elements.grids;
+
+        for ( int i = 0; i < grids.count(); i++ )
         {
-            const auto grid = m_data->effectiveGrid( m_data->elements[i] );
+            const auto grid = m_data->effectiveGrid( grids[i] );
             if ( grid.contains( column, row ) )
                 return i;
         }
@@ -547,8 +580,10 @@ int QskGridLayoutEngine::indexAt( int row, int column ) const
 
 QQuickItem* QskGridLayoutEngine::itemAt( int index ) const
 {
-    if ( const auto element = m_data->elementAt( index ) )
-        return element->item();
+    const auto& elements = m_data->elements;
+
+    if ( elements.isValidIndex( index ) )
+        return elements.items[ index ];
 
     return nullptr;
 }
@@ -567,9 +602,11 @@ int QskGridLayoutEngine::indexOf( const QQuickItem* item ) const
            set additinal properties. So we search in reverse order
          */
 
-        for ( int i = count() - 1; i >= 0; --i )
+        const auto& items = m_data->elements.items;
+
+        for ( int i = items.count() - 1; i >= 0; --i )
         {
-            if ( itemAt( i ) == item )
+            if ( items[i] == item )
                 return i;
         }
     }
@@ -579,8 +616,10 @@ int QskGridLayoutEngine::indexOf( const QQuickItem* item ) const
 
 QSizeF QskGridLayoutEngine::spacerAt( int index ) const
 {
-    if ( const auto element = m_data->elementAt( index ) )
-        return element->spacing();
+    const auto& elements = m_data->elements;
+
+    if ( elements.isValidIndex( index ) && elements.items[ index ] == nullptr )
+        return elements.spacings[ index ];
 
     return QSizeF();
 }
@@ -592,11 +631,13 @@ QQuickItem* QskGridLayoutEngine::itemAt( int row, int column ) const
 
 bool QskGridLayoutEngine::setGridAt( int index, const QRect& grid )
 {
-    if ( auto element = m_data->elementAt( index ) )
+    auto& elements = m_data->elements;
+
+    if ( elements.isValidIndex( index ) )
     {
-        if ( element->grid() != grid )
+        if ( elements.grids[ index ] != grid )
         {
-            element->setGrid( grid );
+            elements.grids[ index ] = grid;
             invalidate();
 
             return true;
@@ -608,33 +649,54 @@ bool QskGridLayoutEngine::setGridAt( int index, const QRect& grid )
 
 QRect QskGridLayoutEngine::gridAt( int index ) const
 {
-    if ( auto element = m_data->elementAt( index ) )
-        return element->grid();
+    const auto& elements = m_data->elements;
+
+    if ( elements.isValidIndex( index ) )
+        return elements.grids[ index ];
 
     return QRect();
 }
 
 QRect QskGridLayoutEngine::effectiveGridAt( int index ) const
 {
-    if ( auto element = m_data->elementAt( index ) )
-        return m_data->effectiveGrid( *element );
+    const auto& elements = m_data->elements;
+
+    if ( elements.isValidIndex( index ) )
+        return m_data->effectiveGrid( elements.grids[ index ] );
 
     return QRect();
 }
 
 void QskGridLayoutEngine::invalidateElementCache()
 {
+    m_data->data.isValid = false;
+}
+
+void QskGridLayoutEngine::collectMeasurements(
+    QskLayoutElement::Measurements& measurements ) const
+{
+    const auto& data = m_data->elementData();
+    const auto& items = m_data->elements.items;
+
+    for ( int i = 0; i < items.count(); i++ )
+    {
+        if ( items[i] && !( data.flags[i] & ElementData::Ignored ) )
+            QskItemLayoutElement( items[i] ).collectMeasurements( measurements );
+    }
 }
 
 void QskGridLayoutEngine::layoutItems()
 {
-    for ( const auto& element : m_data->elements )
+    const auto& items = m_data->elements.items;
+    const auto& grids = m_data->elements.grids;
+
+    for ( int i = 0; i < items.count(); i++ )
     {
-        auto item = element.item();
+        auto item = items[i];
 
         if ( qskIsAdjustableByLayout( item ) )
         {
-            const auto grid = m_data->effectiveGrid( element );
+            const auto grid = m_data->effectiveGrid( grids[i] );
 
             const QskItemLayoutElement layoutElement( item );
 
@@ -647,8 +709,8 @@ void QskGridLayoutEngine::layoutItems()
 
 void QskGridLayoutEngine::transpose()
 {
-    for ( auto& element : m_data->elements )
-        element.transpose();
+    for ( auto& grid : m_data->elements.grids )
+        grid.setRect( grid.top(), grid.left(), grid.height(), grid.width() );
 
     qSwap( m_data->columnSettings, m_data->rowSettings );
     qSwap( m_data->columnCount, m_data->rowCount );
@@ -666,39 +728,63 @@ int QskGridLayoutEngine::effectiveCount(
 void QskGridLayoutEngine::setupChain( Qt::Orientation orientation,
     const QskLayoutChain::Segments& constraints, QskLayoutChain& chain ) const
 {
+    /*
+        Without constraints the hints of the items are taken
+        from the element data, where they have been cached
+        before.
+     */
+    const bool isConstrained = !constraints.isEmpty();
+
+    const auto& data = isConstrained
+        ? m_data->elementData() : m_data->elementData( orientation );
+
+    const auto& items = m_data->elements.items;
+    const auto& grids = data.effectiveGrids;
+    const auto& flags = data.flags;
+    const auto& metrics = data.metrics[ orientation - 1 ];
+
+    const bool isHorizontal = ( orientation == Qt::Horizontal );
+    const int count = grids.count();
+
     /*
         We collect all information from the simple elements first
         before adding those that occupy more than one cell
      */
-    QVarLengthArray< const Element* > postponed;
-    postponed.reserve( m_data->elements.count() );
+    QVarLengthArray< int > postponed;
 
-    for ( const auto& element : m_data->elements )
+    for ( int i = 0; i < count; i++ )
     {
-        if ( element.isIgnored() )
+        if ( flags[i] & ElementData::Ignored )
             continue;
 
-        auto grid = m_data->effectiveGrid( element );
-        if ( orientation == Qt::Horizontal )
-            grid.setRect( grid.y(), grid.x(), grid.height(), grid.width() );
+        const auto& grid = grids[i];
 
-        if ( grid.height() == 1 )
+        const int span = isHorizontal ? grid.width() : grid.height();
+        if ( span != 1 )
         {
-            qreal constraint = -1.0;
-            if ( !constraints.isEmpty() )
-                constraint = qskSegmentLength( constraints, grid.left(), grid.right() );
-
-            auto cell = element.cell( orientation );
+            postponed += i;
+            continue;
+        }
 
-            if ( element.item() )
-                cell.metrics = qskItemMetrics( element.item(), orientation, constraint );
+        auto cell = m_data->cell( i, orientation );
 
-            chain.expandCell( grid.top(), cell );
-        }
-        else
+        if ( auto item = items[i] )
         {
-            postponed += &element;
+            if ( isConstrained )
+            {
+                const auto constraint = isHorizontal
+                    ? qskSegmentLength( constraints, grid.top(), grid.bottom() )
+                    : qskSegmentLength( constraints, grid.left(), grid.right() );
+
+                cell.metrics = qskItemMetrics( item, orientation, constraint );
+            }
+            else
+            {
+                cell.metrics = metrics[i];
+            }
         }
+
+        chain.expandCell( isHorizontal ? grid.left() : grid.top(), cell );
     }
 
     const auto& settings = m_data->settings( orientation );
@@ -706,19 +792,31 @@ void QskGridLayoutEngine::setupChain( Qt::Orientation orientation,
     for ( const auto& setting : settings.settings() )
         chain.shrinkCell( setting.position, setting.cell() );
 
-    for ( const auto element : postponed )
+    for ( const auto i : postponed )
     {
-        auto grid = m_data->effectiveGrid( *element );
-        if ( orientation == Qt::Horizontal )
-            grid.setRect( grid.y(), grid.x(), grid.height(), grid.width() );
+        const auto& grid = grids[i];
 
-        qreal constraint = -1.0;
-        if ( !constraints.isEmpty() )
-            constraint = qskSegmentLength( constraints, grid.left(), grid.right() );
+        auto cell = m_data->cell( i, orientation );
 
-        auto cell = element->cell( orientation );
-        cell.metrics = qskItemMetrics( element->item(), orientation, constraint );
+        if ( auto item = items[i] )
+        {
+            if ( isConstrained )
+            {
+                const auto constraint = isHorizontal
+                    ? qskSegmentLength( constraints, grid.top(), grid.bottom() )
+                    : qskSegmentLength( constraints, grid.left(), grid.right() );
+
+                cell.metrics = qskItemMetrics( item, orientation, constraint );
+            }
+            else
+            {
+                cell.metrics = metrics[i];
+            }
+        }
 
-        chain.expandCells( grid.top(), grid.height(), cell );
+        if ( isHorizontal )
+            chain.expandCells( grid.left(), grid.width(), cell );
+        else
+            chain.expandCells( grid.top(), grid.height(), cell );
     }
 }
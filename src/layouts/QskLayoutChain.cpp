@@ -10,6 +10,9 @@
 #include <qdebug.h>
 
 #include <cmath>
+#include <limits>
+
+static bool qskStretchingCacheEnabled = true;
 
 QskLayoutChain::QskLayoutChain()
 {
@@ -23,6 +26,7 @@ void QskLayoutChain::invalidate()
 {
     m_cells.clear();
     m_constraint = -2;
+    m_stretchings.clear();
 }
 
 void QskLayoutChain::reset( int count, qreal constraint )
@@ -31,6 +35,7 @@ void QskLayoutChain::reset( int count, qreal constraint )
     m_constraint = constraint;
     m_sumStretches = 0;
     m_validCells = 0;
+    m_stretchings.clear();
 }
 
 void QskLayoutChain::shrinkCell( int index, const CellData& newCell )
@@ -169,6 +174,7 @@ void QskLayoutChain::finish()
 
     m_sumStretches = 0;
     m_validCells = 0;
+    m_stretchings.clear();
 
     if ( !m_cells.empty() )
     {
@@ -220,12 +226,30 @@ bool QskLayoutChain::setSpacing( qreal spacing )
     if ( m_spacing != spacing )
     {
         m_spacing = spacing;
+        m_stretchings.clear();
+
         return true;
     }
 
     return false;
 }
 
+bool QskLayoutChain::hasEqualCells( const QskLayoutChain& other ) const
+{
+    return ( m_spacing == other.m_spacing ) && ( m_fillMode == other.m_fillMode )
+        && ( m_cells == other.m_cells );
+}
+
+void QskLayoutChain::setStretchingCacheEnabled( bool on )
+{
+    qskStretchingCacheEnabled = on;
+}
+
+bool QskLayoutChain::isStretchingCacheEnabled()
+{
+    return qskStretchingCacheEnabled;
+}
+
 QskLayoutChain::Segments QskLayoutChain::segments( qreal size ) const
 {
     if ( m_validCells == 0 )
@@ -378,16 +402,52 @@ QskLayoutChain::Segments QskLayoutChain::minimumExpanded( qreal size ) const
 }
 
 QskLayoutChain::Segments QskLayoutChain::preferredStretched( qreal size ) const
+{
+    if ( m_cells.isEmpty() )
+        return Segments();
+
+    if ( !qskStretchingCacheEnabled )
+        return stretched( stretching( size ), size );
+
+    /*
+        Resizing calls segments() for many sizes in a row, where
+        usually the same cells are bounded. So we keep the solutions
+        and only need to apply them for the new size.
+     */
+    for ( const auto& stretching : std::as_const( m_stretchings ) )
+    {
+        if ( stretching.contains( size ) )
+            return stretched( stretching, size );
+    }
+
+    const auto stretching = this->stretching( size );
+
+    if ( stretching.minSize < stretching.maxSize )
+    {
+        if ( m_stretchings.count() >= 8 )
+            m_stretchings.removeFirst();
+
+        m_stretchings += stretching;
+    }
+
+    return stretched( stretching, size );
+}
+
+QskLayoutChain::Stretching QskLayoutChain::stretching( qreal size ) const
 {
     const int count = m_cells.size();
 
-    if ( count == 0 )
-        return Segments();
+    Stretching stretching;
+    stretching.minSize = std::numeric_limits< qreal >::lowest();
+    stretching.maxSize = std::numeric_limits< qreal >::max();
 
-    qreal sumFactors = 0.0;
+    auto& factors = stretching.factors;
+    auto& lengths = stretching.lengths;
 
-    QVarLengthArray< qreal > factors( count );
-    Segments segments( count );
+    factors.resize( count );
+    lengths.fill( 0.0, count );
+
+    qreal sumFactors = 0.0;
 
     for ( int i = 0; i < count; i++ )
     {
@@ -395,7 +455,6 @@ QskLayoutChain::Segments QskLayoutChain::preferredStretched( qreal size ) const
 
         if ( !cell.isValid )
         {
-            segments[i].length = 0.0;
             factors[i] = -1.0;
             continue;
         }
@@ -416,11 +475,12 @@ QskLayoutChain::Segments QskLayoutChain::preferredStretched( qreal size ) const
         sumFactors += factors[i];
     }
 
-    qreal sumSizes = 0.0;
-
     if ( sumFactors > 0.0 )
     {
-        sumSizes = size - ( m_validCells - 1 ) * m_spacing;
+        qreal sumSizes = size - ( m_validCells - 1 ) * m_spacing;
+
+        // size - sumSizes
+        qreal offset = ( m_validCells - 1 ) * m_spacing;
 
         Q_FOREVER
         {
@@ -437,10 +497,46 @@ QskLayoutChain::Segments QskLayoutChain::preferredStretched( qreal size ) const
                 const auto boundedSize =
                     qBound( hint.preferred(), sz, hint.maximum() );
 
+                if ( factors[i] > 0.0 && sumFactors > 0.0 )
+                {
+                    /*
+                        sz is growing with size: the range of sizes,
+                        where the cell is bounded the same way
+                     */
+                    const auto sizeAt = [&]( qreal length )
+                        { return offset + length * sumFactors / factors[i]; };
+
+                    if ( sz < hint.preferred() )
+                    {
+                        stretching.maxSize = qMin( stretching.maxSize,
+                            sizeAt( hint.preferred() ) );
+                    }
+                    else if ( sz > hint.maximum() )
+                    {
+                        stretching.minSize = qMax( stretching.minSize,
+                            sizeAt( hint.maximum() ) );
+                    }
+                    else
+                    {
+                        stretching.minSize = qMax( stretching.minSize,
+                            sizeAt( hint.preferred() ) );
+
+                        if ( hint.maximum() < QskLayoutMetrics::unlimited )
+                        {
+                            stretching.maxSize = qMin( stretching.maxSize,
+                                sizeAt( hint.maximum() ) );
+                        }
+                    }
+                }
+
                 if ( boundedSize != sz )
                 {
-                    segments[i].length = boundedSize;
+                    lengths[i] = boundedSize;
+                    stretching.bounded += i;
+
                     sumSizes -= boundedSize;
+                    offset += boundedSize;
+
                     sumFactors -= factors[i];
                     factors[i] = -1.0;
 
@@ -453,6 +549,32 @@ QskLayoutChain::Segments QskLayoutChain::preferredStretched( qreal size ) const
         }
     }
 
+    stretching.sumFactors = sumFactors;
+
+    return stretching;
+}
+
+QskLayoutChain::Segments QskLayoutChain::stretched(
+    const Stretching& stretching, qreal size ) const
+{
+    const int count = m_cells.size();
+
+    const auto& factors = stretching.factors;
+    const auto& lengths = stretching.lengths;
+
+    qreal sumSizes = 0.0;
+
+    if ( !stretching.bounded.isEmpty() || stretching.sumFactors > 0.0 )
+    {
+        // subtracting in the same order to get identical results
+        sumSizes = size - ( m_validCells - 1 ) * m_spacing;
+
+        for ( const auto i : stretching.bounded )
+            sumSizes -= lengths[i];
+    }
+
+    Segments segments( count );
+
     qreal offset = 0;
     qreal fillSpacing = 0.0;
 
@@ -474,10 +596,14 @@ QskLayoutChain::Segments QskLayoutChain::preferredStretched( qreal size ) const
         if ( factor >= 0.0 )
         {
             if ( factor > 0.0 )
-                segment.length = sumSizes * factor / sumFactors;
+                segment.length = sumSizes * factor / stretching.sumFactors;
             else
                 segment.length = cell.metrics.preferred();
         }
+        else
+        {
+            segment.length = lengths[i];
+        }
 
         offset += segment.length;
     }
@@ -12,7 +12,7 @@
 
 class QDebug;
 
-class QskLayoutChain
+class QSK_EXPORT QskLayoutChain
 {
   public:
     class Segment
@@ -39,6 +39,18 @@ class QskLayoutChain
             metrics.setMetric( which, size );
         }
 
+        inline bool operator==( const CellData& other ) const
+        {
+            return ( stretch == other.stretch ) && ( canGrow == other.canGrow )
+                && ( isShrunk == other.isShrunk ) && ( isValid == other.isValid )
+                && ( metrics == other.metrics );
+        }
+
+        inline bool operator!=( const CellData& other ) const
+        {
+            return !( *this == other );
+        }
+
         int stretch = 0;
         bool canGrow = false;
         bool isShrunk = false;
@@ -78,11 +90,56 @@ class QskLayoutChain
     inline qreal constraint() const { return m_constraint; }
     inline int count() const { return m_cells.size(); }
 
+    // same cells, resulting in the same segments
+    bool hasEqualCells( const QskLayoutChain& ) const;
+
+    /*
+        Solutions of segments() are reused for ranges of sizes, what is
+        supposed to give identical results. Disabling the cache is
+        for comparing both implementations: see playground/layouts
+     */
+    static void setStretchingCacheEnabled( bool );
+    static bool isStretchingCacheEnabled();
+
   private:
+    /*
+        The result of preferredStretched does not change its structure
+        for a range of sizes: the same cells are bounded
+        to their preferred/maximum sizes, while the others share
+        the rest according to their factors.
+     */
+    class Stretching
+    {
+      public:
+        inline bool contains( qreal size ) const
+        {
+            /*
+                The limits are calculated with rounding errors. Close to them
+                the plain algorithm might bound the cells differently, so
+                we stay away from there.
+             */
+            const auto margin = 1e-9 * qMax( qAbs( size ), qreal( 1.0 ) );
+            return ( size > minSize + margin ) && ( size < maxSize - margin );
+        }
+
+        // the range of sizes, exclusive
+        qreal minSize;
+        qreal maxSize;
+
+        QVector< qreal > factors; // < 0: length is fixed
+        QVector< qreal > lengths;
+        QVector< int > bounded; // in order of being bounded
+
+        qreal sumFactors = 0.0;
+    };
+
     Segments distributed( int which, qreal offset, qreal extra ) const;
     Segments minimumExpanded( qreal size ) const;
     Segments preferredStretched( qreal size ) const;
 
+    Stretching stretching( qreal size ) const;
+    Segments stretched( const Stretching&, qreal size ) const;
+
     QskLayoutMetrics m_boundingMetrics;
     qreal m_constraint = -2.0;
 
@@ -93,6 +150,9 @@ class QskLayoutChain
     int m_validCells = 0;
 
     QVector< CellData > m_cells;
+
+    // solutions of preferredStretched for ranges of sizes
+    mutable QVector< Stretching > m_stretchings;
 };
 
 #ifndef QT_NO_DEBUG_STREAM
@@ -22,6 +22,10 @@ QskLayoutElement::~QskLayoutElement()
 {
 }
 
+void QskLayoutElement::collectMeasurements( Measurements& ) const
+{
+}
+
 QSizeF QskLayoutElement::sizeConstraint(
     Qt::SizeHint which, const QSizeF& constraint ) const
 {
@@ -362,6 +366,8 @@ qreal QskLayoutElement::boundedSize( Qt::Orientation orientation, qreal size ) c
 }
 
 #include "QskQuick.h"
+#include "QskControl.h"
+#include "QskSkinlet.h"
 
 QskItemLayoutElement::QskItemLayoutElement( const QQuickItem* item )
     : m_item( item )
@@ -383,3 +389,15 @@ Qt::Alignment QskItemLayoutElement::alignment() const
 {
     return qskLayoutAlignmentHint( m_item );
 }
+
+void QskItemLayoutElement::collectMeasurements( Measurements& measurements ) const
+{
+    if ( auto control = qskControlCast( m_item ) )
+    {
+        if ( control->explicitSizeHint( Qt::PreferredSize ).isValid() )
+            return; // the skinlet won't be asked
+
+        if ( auto skinlet = control->effectiveSkinlet() )
+            skinlet->collectMeasurements( control, measurements );
+    }
+}
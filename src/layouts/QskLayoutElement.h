@@ -10,6 +10,9 @@
 #include <qnamespace.h>
 #include <qrect.h>
 
+#include <functional>
+#include <vector>
+
 class QskSizePolicy;
 class QskLayoutMetrics;
 
@@ -34,6 +37,14 @@ class QSK_EXPORT QskLayoutElement
     qreal heightForWidth( qreal ) const;
     qreal widthForHeight( qreal ) const;
 
+    using Measurements = std::vector< std::function< void() > >;
+
+    /*
+        Appends jobs, that warm up caches for the following sizeHint()
+        calls. They might be run in parallel on worker threads.
+     */
+    virtual void collectMeasurements( Measurements& ) const;
+
   private:
     Q_DISABLE_COPY( QskLayoutElement )
 
@@ -62,6 +73,8 @@ class QSK_EXPORT QskItemLayoutElement final : public QskLayoutElement
     QskSizePolicy sizePolicy() const override;
     Qt::Alignment alignment() const override;
 
+    void collectMeasurements( Measurements& ) const override;
+
   private:
     QSizeF sizeHint( Qt::SizeHint, const QSizeF& ) const override;
 
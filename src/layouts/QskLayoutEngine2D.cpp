@@ -9,9 +9,42 @@
 #include "QskFunctions.h"
 
 #include <qguiapplication.h>
+#include <qthreadpool.h>
+#include <qsemaphore.h>
+
+#include <atomic>
+
+static std::atomic< int > qskMeasurementThreshold { 64 };
 
 namespace
 {
+    class MeasurementRunnable final : public QRunnable
+    {
+      public:
+        using Measurement = QskLayoutElement::Measurements::value_type;
+
+        MeasurementRunnable( const Measurement* begin,
+                const Measurement* end, QSemaphore* semaphore )
+            : m_begin( begin )
+            , m_end( end )
+            , m_semaphore( semaphore )
+        {
+        }
+
+        void run() override
+        {
+            for ( auto measurement = m_begin; measurement != m_end; ++measurement )
+                ( *measurement )();
+
+            m_semaphore->release();
+        }
+
+      private:
+        const Measurement* m_begin;
+        const Measurement* m_end;
+        QSemaphore* m_semaphore;
+    };
+
     class LayoutData
     {
       public:
@@ -43,6 +76,7 @@ class QskLayoutEngine2D::PrivateData
         , visualDirection( Qt::LeftToRight )
         , constraintType( -1 )
         , blockInvalidate( false )
+        , measurementsPending( true )
     {
     }
 
@@ -87,8 +121,66 @@ class QskLayoutEngine2D::PrivateData
         because of them.
      */
     bool blockInvalidate : 1;
+
+    // the elements have not been measured since the last invalidate( ElementCache )
+    bool measurementsPending : 1;
 };
 
+static void qskRunMeasurements( const QskLayoutElement::Measurements& measurements )
+{
+    const int count = static_cast< int >( measurements.size() );
+
+    /*
+        The global pool is shared with the application, that might
+        keep it busy with jobs of its own. So we only use idle threads
+        and process all chunks, that could not be started, ourselves
+        instead of waiting for threads becoming available.
+     */
+    auto pool = QThreadPool::globalInstance();
+
+    const int idleCount = pool->maxThreadCount() - pool->activeThreadCount();
+    const int threadCount = qMin( idleCount + 1, count );
+
+    if ( threadCount <= 1 )
+    {
+        for ( const auto& measurement : measurements )
+            measurement();
+
+        return;
+    }
+
+    // the first chunk is processed by the calling thread
+
+    const auto chunkSize = ( count + threadCount - 1 ) / threadCount;
+    const auto begin = measurements.data();
+
+    QSemaphore semaphore;
+
+    int chunkCount = 0;
+    for ( int i = chunkSize; i < count; i += chunkSize )
+    {
+        const auto end = begin + qMin( i + chunkSize, count );
+
+        auto runnable = new MeasurementRunnable( begin + i, end, &semaphore );
+        if ( pool->tryStart( runnable ) )
+        {
+            chunkCount++;
+        }
+        else
+        {
+            delete runnable;
+
+            for ( auto measurement = begin + i; measurement != end; ++measurement )
+                ( *measurement )();
+        }
+    }
+
+    for ( auto measurement = begin; measurement != begin + chunkSize; ++measurement )
+        ( *measurement )();
+
+    semaphore.acquire( chunkCount );
+}
+
 QskLayoutEngine2D::QskLayoutEngine2D()
     : m_data( new PrivateData )
 {
@@ -333,6 +425,8 @@ QSizeF QskLayoutEngine2D::sizeHint(
 
     m_data->blockInvalidate = true;
 
+    measureElements();
+
     switch( requestType )
     {
         case QskSizePolicy::HeightForWidth:
@@ -414,6 +508,8 @@ void QskLayoutEngine2D::updateSegments( const QSizeF& size ) const
 
     m_data->blockInvalidate = true;
 
+    measureElements();
+
     switch( constraintType() )
     {
         case QskSizePolicy::WidthForHeight:
@@ -449,6 +545,28 @@ void QskLayoutEngine2D::updateSegments( const QSizeF& size ) const
     m_data->blockInvalidate = false;
 }
 
+void QskLayoutEngine2D::measureElements() const
+{
+    if ( !m_data->measurementsPending )
+        return;
+
+    m_data->measurementsPending = false;
+
+    const int threshold = qskMeasurementThreshold;
+    if ( threshold <= 0 || count() < threshold )
+        return;
+
+    QskLayoutElement::Measurements measurements;
+    collectMeasurements( measurements );
+
+    if ( !measurements.empty() )
+        qskRunMeasurements( measurements );
+}
+
+void QskLayoutEngine2D::collectMeasurements( QskLayoutElement::Measurements& ) const
+{
+}
+
 void QskLayoutEngine2D::invalidate( int what )
 {
     if ( m_data->blockInvalidate )
@@ -457,6 +575,8 @@ void QskLayoutEngine2D::invalidate( int what )
     if ( what & ElementCache )
     {
         m_data->constraintType = -1;
+        m_data->measurementsPending = true;
+
         invalidateElementCache();
     }
 
@@ -471,6 +591,81 @@ void QskLayoutEngine2D::invalidate( int what )
     }
 }
 
+bool QskLayoutEngine2D::updateHints()
+{
+    if ( m_data->blockInvalidate )
+        return false;
+
+    const auto oldType = m_data->constraintType;
+    invalidate( ElementCache );
+
+    if ( ( oldType != QskSizePolicy::Unconstrained )
+        || ( constraintType() != QskSizePolicy::Unconstrained ) )
+    {
+        /*
+            The chain of the second orientation depends on the segments
+            of the first one. We don't try to be smart here.
+         */
+        invalidate( LayoutCache );
+        return true;
+    }
+
+    measureElements();
+
+    bool hintsChanged = false;
+    bool cellsChanged = false;
+
+    for ( auto orientation : { Qt::Horizontal, Qt::Vertical } )
+    {
+        auto& chain = m_data->layoutChain( orientation );
+
+        if ( chain.constraint() != -1.0 )
+        {
+            // not being set up yet
+            chain.invalidate();
+            cellsChanged = hintsChanged = true;
+
+            continue;
+        }
+
+        /*
+            Rebuilding the chain is cheap, as the hints of the
+            unmodified elements are cached by the elements.
+            What we want to avoid is recalculating the segments and
+            resetting the implicit size of the box, when nothing
+            relevant has changed.
+         */
+        auto newChain = chain;
+
+        m_data->blockInvalidate = true;
+
+        newChain.reset( effectiveCount( orientation ), -1.0 );
+        setupChain( orientation, QskLayoutChain::Segments(), newChain );
+        newChain.finish();
+
+        m_data->blockInvalidate = false;
+
+        if ( !newChain.hasEqualCells( chain ) )
+        {
+            cellsChanged = true;
+
+            if ( !( newChain.boundingMetrics() == chain.boundingMetrics() ) )
+                hintsChanged = true;
+
+            chain = newChain;
+        }
+    }
+
+    if ( cellsChanged )
+    {
+        m_data->layoutSize = QSize();
+        m_data->rows.clear();
+        m_data->columns.clear();
+    }
+
+    return hintsChanged;
+}
+
 QskSizePolicy::ConstraintType QskLayoutEngine2D::constraintType() const
 {
     if ( m_data->constraintType < 0 )
@@ -500,3 +695,13 @@ QskSizePolicy::ConstraintType QskLayoutEngine2D::constraintType() const
 
     return static_cast< QskSizePolicy::ConstraintType >( m_data->constraintType );
 }
+
+void QskLayoutEngine2D::setMeasurementThreshold( int threshold )
+{
+    qskMeasurementThreshold = threshold;
+}
+
+int QskLayoutEngine2D::measurementThreshold()
+{
+    return qskMeasurementThreshold;
+}
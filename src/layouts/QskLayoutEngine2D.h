@@ -8,13 +8,12 @@
 
 #include "QskGlobal.h"
 #include "QskLayoutChain.h"
+#include "QskLayoutElement.h"
 #include "QskSizePolicy.h"
 
 #include <qnamespace.h>
 #include <memory>
 
-class QskLayoutElement;
-
 class QSK_EXPORT QskLayoutEngine2D
 {
   public:
@@ -42,6 +41,16 @@ class QSK_EXPORT QskLayoutEngine2D
 
     void invalidate();
 
+    /*
+        Updates the layout after the size hints of elements have changed
+        without knowing which ones. As long as the cells of the layout
+        remain the same, the calculated segments are kept.
+
+        Returns true, when the size hints of the layout itself might
+        have been affected.
+     */
+    bool updateHints();
+
     qreal widthForHeight( qreal height ) const;
     qreal heightForWidth( qreal width ) const;
 
@@ -49,6 +58,17 @@ class QSK_EXPORT QskLayoutEngine2D
 
     void setGeometries( const QRectF& );
 
+    /*
+        Before setting up the chains of a layout with at least
+        measurementThreshold() elements, the expensive parts of
+        the size hints ( f.e. text sizes ) are precalculated in parallel
+        by the idle threads of the global thread pool.
+        For a threshold <= 0 all measurements are done serially,
+        when setting up the chains.
+     */
+    static void setMeasurementThreshold( int );
+    static int measurementThreshold();
+
   protected:
     QRectF geometryAt( const QskLayoutElement*, const QRect& grid ) const;
 
@@ -64,6 +84,7 @@ class QSK_EXPORT QskLayoutEngine2D
     Q_DISABLE_COPY( QskLayoutEngine2D )
 
     void updateSegments( const QSizeF& ) const;
+    void measureElements() const;
 
     virtual void layoutItems() = 0;
     virtual int effectiveCount( Qt::Orientation ) const = 0;
@@ -72,6 +93,7 @@ class QSK_EXPORT QskLayoutEngine2D
     QskSizePolicy::ConstraintType constraintType() const;
 
     virtual QskSizePolicy sizePolicyAt( int index ) const = 0;
+    virtual void collectMeasurements( QskLayoutElement::Measurements& ) const;
 
     void setupChain( Qt::Orientation ) const;
     void setupChain( Qt::Orientation, const QskLayoutChain::Segments& ) const;
@@ -461,6 +461,19 @@ void QskLinearLayoutEngine::invalidateElementCache()
     m_data->sumIgnored = -1;
 }
 
+void QskLinearLayoutEngine::collectMeasurements(
+    QskLayoutElement::Measurements& measurements ) const
+{
+    for ( const auto& element : m_data->elements )
+    {
+        if ( element.isIgnored() )
+            continue;
+
+        if ( auto item = element.item() )
+            QskItemLayoutElement( item ).collectMeasurements( measurements );
+    }
+}
+
 void QskLinearLayoutEngine::setupChain( Qt::Orientation orientation,
     const QskLayoutChain::Segments& constraints, QskLayoutChain& chain ) const
 {
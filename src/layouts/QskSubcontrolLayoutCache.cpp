@@ -0,0 +1,66 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) The authors
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#include "QskSubcontrolLayoutCache.h"
+#include "QskSubcontrolLayoutEngine.h"
+#include "QskControlPrivate.h"
+
+bool QskSubcontrolLayoutCache::find( const QRectF& rect, QskAspect::States states,
+    int index, QskAspect::Subcontrol subControl, QRectF& subControlRect ) const
+{
+    for ( int i = 0; i < m_count; i++ )
+    {
+        const auto& slot = m_slots[i];
+
+        if ( slot.index == index && slot.states == states && slot.rect == rect )
+        {
+            // subcontrols without an element are invalid, like in the engine
+            subControlRect = QRectF( 0.0, 0.0, -1.0, -1.0 );
+
+            for ( const auto& entry : slot.rects )
+            {
+                if ( entry.first == subControl )
+                {
+                    subControlRect = entry.second;
+                    break;
+                }
+            }
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void QskSubcontrolLayoutCache::insert( const QRectF& rect, QskAspect::States states,
+    int index, const QskSubcontrolLayoutEngine& engine )
+{
+    auto& slot = m_slots[ m_next ];
+
+    slot.rect = rect;
+    slot.states = states;
+    slot.index = index;
+
+    slot.rects.clear();
+
+    for ( int i = 0; i < engine.count(); i++ )
+    {
+        const auto element = engine.elementAt( i );
+        slot.rects.append( { element->subControl(), element->geometry() } );
+    }
+
+    m_next = ( m_next + 1 ) % SlotCount;
+    m_count = qMin( m_count + 1, int( SlotCount ) );
+}
+
+QskSubcontrolLayoutCache* qskSubcontrolLayoutCache(
+    const QskSkinnable* skinnable, bool create )
+{
+    if ( auto control = qskControlCast( skinnable->owningItem() ) )
+        return QskControlPrivate::subcontrolLayoutCache( control, create );
+
+    return nullptr;
+}
@@ -0,0 +1,97 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) The authors
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#ifndef QSK_SUBCONTROL_LAYOUT_CACHE_H
+#define QSK_SUBCONTROL_LAYOUT_CACHE_H
+
+#include "QskGlobal.h"
+#include "QskAspect.h"
+#include "QskSkinnable.h"
+
+#include <qrect.h>
+#include <qvarlengtharray.h>
+
+#include <utility>
+
+class QskSubcontrolLayoutEngine;
+
+/*
+    The rectangles of the subcontrols, that have been calculated by a
+    QskSubcontrolLayoutEngine for the most recently used geometries.
+
+    Skinlets are asked for the rectangles of each subcontrol separately,
+    while the engine always lays out all of them. So the results are
+    memoized in the control, where the cache gets cleared together
+    with the cached size hints ( see QskControl::resetImplicitSize ).
+
+    Geometry, states and the index of a sample are part of the key.
+ */
+class QskSubcontrolLayoutCache
+{
+  public:
+    QskSubcontrolLayoutCache() = default;
+
+    bool find( const QRectF&, QskAspect::States, int index,
+        QskAspect::Subcontrol, QRectF& ) const;
+
+    void insert( const QRectF&, QskAspect::States, int index,
+        const QskSubcontrolLayoutEngine& );
+
+    void clear();
+
+  private:
+    static constexpr int SlotCount = 8;
+
+    struct Slot
+    {
+        QRectF rect;
+        QskAspect::States states;
+        int index;
+
+        QVarLengthArray< std::pair< QskAspect::Subcontrol, QRectF >, 2 > rects;
+    };
+
+    Slot m_slots[ SlotCount ];
+
+    int m_count = 0;
+    int m_next = 0;
+};
+
+inline void QskSubcontrolLayoutCache::clear()
+{
+    m_count = m_next = 0;
+}
+
+// the cache of the control owning the skinnable, nullptr for other skinnables
+QskSubcontrolLayoutCache* qskSubcontrolLayoutCache(
+    const QskSkinnable*, bool create = true );
+
+/*
+    The rectangle of a subcontrol, when laying out an Engine, that
+    is created from args, for rect. The engine is only created,
+    when there is no memoized result.
+ */
+template< typename Engine, typename... Args >
+QRectF qskSubcontrolLayoutRect( const QskSkinnable* skinnable,
+    const QRectF& rect, int index, QskAspect::Subcontrol subControl, Args&&... args )
+{
+    const auto states = skinnable->skinStates();
+
+    auto cache = qskSubcontrolLayoutCache( skinnable );
+
+    QRectF subControlRect;
+    if ( cache && cache->find( rect, states, index, subControl, subControlRect ) )
+        return subControlRect;
+
+    Engine engine( std::forward< Args >( args )... );
+    engine.setGeometries( rect );
+
+    if ( cache )
+        cache->insert( rect, states, index, engine );
+
+    return engine.subControlRect( subControl );
+}
+
+#endif
@@ -0,0 +1,631 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) The authors
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#include "QskVirtualLinearBox.h"
+#include "QskPrefixSumIndex.h"
+#include "QskEvent.h"
+#include "QskQuick.h"
+
+#include <qbitarray.h>
+#include <qhash.h>
+#include <qquickwindow.h>
+
+static QRectF qskViewportRect( const QQuickItem* item )
+{
+    /*
+        The clip rectangle of the nearest clipping ancestor,
+        f.e the viewport of a QskScrollArea. Transformations
+        beside translations are not respected.
+     */
+    for ( auto it = item->parentItem(); it; it = it->parentItem() )
+    {
+        if ( it->clip() )
+        {
+            const auto r = it->clipRect();
+            return QRectF( item->mapFromItem( it, r.topLeft() ), r.size() );
+        }
+    }
+
+    if ( auto window = item->window() )
+        return QRectF( item->mapFromScene( QPointF() ), window->size() );
+
+    return QRectF();
+}
+
+class QskVirtualLinearBox::PrivateData
+{
+  public:
+    inline qreal estimate() const
+    {
+        if ( estimatedExtent >= 0.0 )
+            return estimatedExtent;
+
+        if ( measuredCount > 0 )
+            return measuredSum / measuredCount;
+
+        return fallbackExtent;
+    }
+
+    inline qreal extentAt( int index ) const
+    {
+        return extents.value( index ) - spacing;
+    }
+
+    inline qreal totalExtent() const
+    {
+        return ( count > 0 ) ? extents.sum() - spacing : 0.0;
+    }
+
+    void setExtentAt( int index, qreal extent )
+    {
+        if ( measured.testBit( index ) )
+        {
+            measuredSum -= extentAt( index );
+        }
+        else
+        {
+            measured.setBit( index );
+            measuredCount++;
+        }
+
+        measuredSum += extent;
+        extents.setValue( index, extent + spacing );
+    }
+
+    void resetExtentAt( int index )
+    {
+        if ( measured.testBit( index ) )
+        {
+            measuredSum -= extentAt( index );
+            measuredCount--;
+
+            measured.clearBit( index );
+        }
+
+        extents.setValue( index, qMax( estimate(), 0.0 ) + spacing );
+    }
+
+    void resetExtents( bool keepEstimate )
+    {
+        // the estimate for the items, that have not been measured again
+        fallbackExtent = keepEstimate ? estimate() : -1.0;
+
+        measured.fill( false, count );
+        measuredSum = 0.0;
+        measuredCount = 0;
+
+        perpendicularHint = -1.0;
+
+        updateExtents( spacing );
+    }
+
+    void updateExtents( qreal newSpacing )
+    {
+        // O(n): the measured extents are kept, all others are estimated
+
+        const auto estimated = qMax( estimate(), 0.0 );
+
+        QVector< qreal > values;
+        values.reserve( count );
+
+        for ( int i = 0; i < count; i++ )
+        {
+            const bool isMeasured = ( i < extents.count() ) && measured.testBit( i );
+            values += ( isMeasured ? extentAt( i ) : estimated ) + newSpacing;
+        }
+
+        spacing = newSpacing;
+        extents.setValues( values );
+    }
+
+    // extent + spacing for each index
+    QskPrefixSumIndex extents;
+    QBitArray measured;
+
+    qreal measuredSum = 0.0;
+    int measuredCount = 0;
+
+    qreal estimatedExtent = -1.0;
+    qreal fallbackExtent = -1.0;
+
+    // the width/height, that has been used for measuring the items
+    qreal layoutExtent = -1.0;
+    qreal perpendicularHint = -1.0;
+
+    QSizeF layoutHint;
+    QRectF viewport;
+
+    QHash< int, QQuickItem* > items; // instantiated items
+    QVector< QQuickItem* > pool; // hidden items for recycling
+
+    int count = 0;
+    int overscan = 2;
+    qreal spacing = 0.0;
+
+    /*
+        Showing/hiding/updating the items from inside of the box
+        results in LayoutRequests, that are sent synchronously and
+        are no reason to remeasure the items.
+     */
+    int blockLayoutRequests = 0;
+
+    Qt::Orientation orientation = Qt::Vertical;
+};
+
+QskVirtualLinearBox::QskVirtualLinearBox( QQuickItem* parent )
+    : QskVirtualLinearBox( Qt::Vertical, parent )
+{
+}
+
+QskVirtualLinearBox::QskVirtualLinearBox(
+        Qt::Orientation orientation, QQuickItem* parent )
+    : Inherited( false, parent )
+    , m_data( new PrivateData() )
+{
+    m_data->orientation = orientation;
+
+#if QT_VERSION >= QT_VERSION_CHECK( 6, 3, 0 )
+    setFlag( QQuickItem::ItemObservesViewport, true );
+#endif
+
+    if ( orientation == Qt::Vertical )
+        initSizePolicy( QskSizePolicy::Preferred, QskSizePolicy::Minimum );
+    else
+        initSizePolicy( QskSizePolicy::Minimum, QskSizePolicy::Preferred );
+}
+
+QskVirtualLinearBox::~QskVirtualLinearBox()
+{
+}
+
+void QskVirtualLinearBox::setOrientation( Qt::Orientation orientation )
+{
+    if ( orientation == m_data->orientation )
+        return;
+
+    m_data->orientation = orientation;
+    setSizePolicy( sizePolicy().transposed() );
+
+    // the extents in the other direction are of no use
+
+    m_data->layoutExtent = -1.0;
+    m_data->resetExtents( false );
+
+    resetImplicitSize();
+    polish();
+
+    Q_EMIT orientationChanged();
+}
+
+Qt::Orientation QskVirtualLinearBox::orientation() const
+{
+    return m_data->orientation;
+}
+
+void QskVirtualLinearBox::setCount( int count )
+{
+    count = qMax( count, 0 );
+    if ( count == m_data->count )
+        return;
+
+    for ( int i = count; i < m_data->count; i++ )
+    {
+        if ( m_data->measured.testBit( i ) )
+        {
+            m_data->measuredSum -= m_data->extentAt( i );
+            m_data->measuredCount--;
+        }
+    }
+
+    m_data->measured.resize( count );
+    m_data->count = count;
+
+    m_data->updateExtents( m_data->spacing );
+
+    resetImplicitSize();
+    polish();
+
+    Q_EMIT countChanged();
+}
+
+int QskVirtualLinearBox::count() const
+{
+    return m_data->count;
+}
+
+void QskVirtualLinearBox::setSpacing( qreal spacing )
+{
+    spacing = qMax( spacing, 0.0 );
+    if ( spacing == m_data->spacing )
+        return;
+
+    m_data->updateExtents( spacing );
+
+    resetImplicitSize();
+    polish();
+
+    Q_EMIT spacingChanged();
+}
+
+qreal QskVirtualLinearBox::spacing() const
+{
+    return m_data->spacing;
+}
+
+void QskVirtualLinearBox::setOverscan( int overscan )
+{
+    overscan = qMax( overscan, 0 );
+    if ( overscan == m_data->overscan )
+        return;
+
+    m_data->overscan = overscan;
+    polish();
+
+    Q_EMIT overscanChanged();
+}
+
+int QskVirtualLinearBox::overscan() const
+{
+    return m_data->overscan;
+}
+
+void QskVirtualLinearBox::setEstimatedItemExtent( qreal extent )
+{
+    if ( extent < 0.0 )
+        extent = -1.0;
+
+    if ( extent == m_data->estimatedExtent )
+        return;
+
+    m_data->estimatedExtent = extent;
+    m_data->updateExtents( m_data->spacing );
+
+    resetImplicitSize();
+    polish();
+
+    Q_EMIT estimatedItemExtentChanged();
+}
+
+void QskVirtualLinearBox::resetEstimatedItemExtent()
+{
+    setEstimatedItemExtent( -1.0 );
+}
+
+qreal QskVirtualLinearBox::estimatedItemExtent() const
+{
+    return m_data->estimatedExtent;
+}
+
+QQuickItem* QskVirtualLinearBox::itemAtIndex( int index ) const
+{
+    return m_data->items.value( index, nullptr );
+}
+
+int QskVirtualLinearBox::indexOf( const QQuickItem* item ) const
+{
+    if ( item )
+    {
+        for ( auto it = m_data->items.constBegin();
+            it != m_data->items.constEnd(); ++it )
+        {
+            if ( it.value() == item )
+                return it.key();
+        }
+    }
+
+    return -1;
+}
+
+QRectF QskVirtualLinearBox::geometryAt( int index ) const
+{
+    if ( index < 0 || index >= m_data->count )
+        return QRectF();
+
+    const auto rect = layoutRect();
+
+    const qreal pos = m_data->extents.prefixSum( index );
+    const qreal extent = m_data->extentAt( index );
+
+    if ( m_data->orientation == Qt::Vertical )
+        return QRectF( rect.left(), rect.top() + pos, rect.width(), extent );
+    else
+        return QRectF( rect.left() + pos, rect.top(), extent, rect.height() );
+}
+
+void QskVirtualLinearBox::updateItems( int from, int to )
+{
+    from = qMax( from, 0 );
+    to = qMin( to, m_data->count - 1 );
+
+    m_data->blockLayoutRequests++;
+
+    for ( int i = from; i <= to; i++ )
+    {
+        m_data->resetExtentAt( i );
+
+        if ( auto item = m_data->items.value( i, nullptr ) )
+            updateItem( item, i );
+    }
+
+    m_data->blockLayoutRequests--;
+
+    polish();
+}
+
+void QskVirtualLinearBox::resetItems()
+{
+    m_data->resetExtents( true );
+
+    m_data->blockLayoutRequests++;
+
+    for ( auto it = m_data->items.constBegin();
+        it != m_data->items.constEnd(); ++it )
+    {
+        updateItem( it.value(), it.key() );
+    }
+
+    m_data->blockLayoutRequests--;
+
+    resetImplicitSize();
+    polish();
+}
+
+QQuickItem* QskVirtualLinearBox::acquireItem( int index )
+{
+    QQuickItem* item = nullptr;
+
+    if ( !m_data->pool.isEmpty() )
+    {
+        item = m_data->pool.takeLast();
+    }
+    else
+    {
+        item = createItem();
+        if ( item == nullptr )
+            return nullptr;
+
+        item->setParentItem( this );
+        if ( item->parent() == nullptr )
+            item->setParent( this );
+    }
+
+    updateItem( item, index );
+    item->setVisible( true );
+
+    return item;
+}
+
+void QskVirtualLinearBox::releaseItem( QQuickItem* item )
+{
+    item->setVisible( false );
+    m_data->pool += item;
+}
+
+void QskVirtualLinearBox::measureItem( QQuickItem* item, int index )
+{
+    const auto extent = m_data->layoutExtent;
+
+    qreal hint, perpendicularHint;
+
+    if ( m_data->orientation == Qt::Vertical )
+    {
+        hint = qskSizeConstraint( item,
+            Qt::PreferredSize, QSizeF( extent, -1.0 ) ).height();
+
+        perpendicularHint = qskSizeConstraint(
+            item, Qt::PreferredSize, QSizeF() ).width();
+    }
+    else
+    {
+        hint = qskSizeConstraint( item,
+            Qt::PreferredSize, QSizeF( -1.0, extent ) ).width();
+
+        perpendicularHint = qskSizeConstraint(
+            item, Qt::PreferredSize, QSizeF() ).height();
+    }
+
+    m_data->setExtentAt( index, qMax( hint, 0.0 ) );
+    m_data->perpendicularHint = qMax( m_data->perpendicularHint, perpendicularHint );
+}
+
+void QskVirtualLinearBox::updateLayout()
+{
+    if ( maybeUnresized() )
+        return;
+
+    m_data->blockLayoutRequests++;
+    layoutItems();
+    m_data->blockLayoutRequests--;
+
+    const auto hint = layoutSizeHint( Qt::PreferredSize, QSizeF() );
+    if ( hint != m_data->layoutHint )
+    {
+        m_data->layoutHint = hint;
+        resetImplicitSize();
+    }
+}
+
+void QskVirtualLinearBox::layoutItems()
+{
+    const bool isVertical = ( m_data->orientation == Qt::Vertical );
+    const auto rect = layoutRect();
+
+    {
+        const qreal extent = isVertical ? rect.width() : rect.height();
+        if ( extent != m_data->layoutExtent )
+        {
+            // the extents of the items depend on the width/height of the box
+            m_data->layoutExtent = extent;
+            m_data->resetExtents( true );
+        }
+    }
+
+    const auto viewport = qskViewportRect( this );
+    m_data->viewport = viewport;
+
+    qreal from, to;
+    if ( isVertical )
+    {
+        from = viewport.top() - rect.top();
+        to = viewport.bottom() - rect.top();
+    }
+    else
+    {
+        from = viewport.left() - rect.left();
+        to = viewport.right() - rect.left();
+    }
+
+    QHash< int, QQuickItem* > items;
+    items.swap( m_data->items );
+
+    const int count = m_data->count;
+    auto& extents = m_data->extents;
+
+    if ( count > 0 && from < to )
+    {
+        if ( m_data->estimate() < 0.0 )
+        {
+            // nothing to estimate from: measuring the first item
+            auto item = items.take( 0 );
+            if ( item == nullptr )
+                item = acquireItem( 0 );
+
+            if ( item )
+            {
+                measureItem( item, 0 );
+                items.insert( 0, item );
+
+                m_data->updateExtents( m_data->spacing );
+            }
+        }
+
+        const int first = qMax( qBound( 0, extents.indexAt( from ), count - 1 )
+            - m_data->overscan, 0 );
+
+        {
+            /*
+                Releasing the items, that are not needed according to
+                the current estimates first, so that they can be recycled
+             */
+            const int last = extents.indexAt( to ) + m_data->overscan;
+
+            for ( auto it = items.begin(); it != items.end(); )
+            {
+                if ( it.key() < first || it.key() > last || it.key() >= count )
+                {
+                    releaseItem( it.value() );
+                    it = items.erase( it );
+                }
+                else
+                {
+                    ++it;
+                }
+            }
+        }
+
+        int trailing = 0;
+
+        for ( int index = first; index < count; index++ )
+        {
+            /*
+                Measuring an item only shifts the items behind,
+                so the positions of the items being placed so far
+                remain valid
+             */
+            const qreal pos = extents.prefixSum( index );
+
+            if ( pos >= to && trailing++ >= m_data->overscan )
+                break;
+
+            auto item = items.take( index );
+            if ( item == nullptr )
+            {
+                item = acquireItem( index );
+                if ( item == nullptr )
+                    continue;
+            }
+
+            if ( !m_data->measured.testBit( index ) )
+                measureItem( item, index );
+
+            const qreal extent = m_data->extentAt( index );
+
+            const auto itemRect = isVertical
+                ? QRectF( rect.left(), rect.top() + pos, rect.width(), extent )
+                : QRectF( rect.left() + pos, rect.top(), extent, rect.height() );
+
+            qskSetItemGeometry( item, itemRect );
+            m_data->items.insert( index, item );
+        }
+    }
+
+    for ( auto item : std::as_const( items ) )
+        releaseItem( item );
+}
+
+QSizeF QskVirtualLinearBox::layoutSizeHint(
+    Qt::SizeHint which, const QSizeF& ) const
+{
+    if ( which != Qt::PreferredSize )
+        return QSizeF();
+
+    /*
+        The extent is the sum of the measured and estimated extents
+        for the current width/height of the box and ignores
+        the constraint.
+     */
+
+    const auto extent = m_data->totalExtent();
+
+    if ( m_data->orientation == Qt::Vertical )
+        return QSizeF( m_data->perpendicularHint, extent );
+    else
+        return QSizeF( extent, m_data->perpendicularHint );
+}
+
+bool QskVirtualLinearBox::event( QEvent* event )
+{
+    switch ( static_cast< int >( event->type() ) )
+    {
+        case QEvent::LayoutRequest:
+        {
+            if ( m_data->blockLayoutRequests > 0 )
+                return true;
+
+            // the hints of one of the instantiated items might have changed
+            for ( auto it = m_data->items.constBegin();
+                it != m_data->items.constEnd(); ++it )
+            {
+                m_data->resetExtentAt( it.key() );
+            }
+
+            polish();
+            break;
+        }
+        case QEvent::ContentsRectChange:
+        {
+            polish();
+            break;
+        }
+    }
+
+    return Inherited::event( event );
+}
+
+void QskVirtualLinearBox::geometryChangeEvent( QskGeometryChangeEvent* event )
+{
+    Inherited::geometryChangeEvent( event );
+
+    if ( event->isResized() )
+        polish();
+}
+
+void QskVirtualLinearBox::viewportChangeEvent( QskViewportChangeEvent* )
+{
+    if ( qskViewportRect( this ) != m_data->viewport )
+        polish();
+}
+
+#include "moc_QskVirtualLinearBox.cpp"
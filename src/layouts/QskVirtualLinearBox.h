@@ -0,0 +1,112 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) The authors
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#ifndef QSK_VIRTUAL_LINEAR_BOX_H
+#define QSK_VIRTUAL_LINEAR_BOX_H
+
+#include "QskBox.h"
+
+/*
+    A linear layout for a huge number of items, where only the
+    items intersecting the viewport - plus a couple of extra items
+    before/after it ( overscan ) - are instantiated.
+
+    The items are created by createItem() and bound to an index
+    by updateItem(). Items leaving the viewport are hidden and reused
+    for other indexes, when scrolling.
+
+    The extents of items, that have not been instantiated yet, are
+    estimated - either from estimatedItemExtent or from the average
+    of the items, that have been measured so far.
+
+    The box is intended to be the scrolledItem of a QskScrollArea.
+ */
+class QSK_EXPORT QskVirtualLinearBox : public QskBox
+{
+    Q_OBJECT
+
+    Q_PROPERTY( Qt::Orientation orientation READ orientation
+        WRITE setOrientation NOTIFY orientationChanged FINAL )
+
+    Q_PROPERTY( int count READ count WRITE setCount NOTIFY countChanged FINAL )
+
+    Q_PROPERTY( qreal spacing READ spacing
+        WRITE setSpacing NOTIFY spacingChanged FINAL )
+
+    Q_PROPERTY( int overscan READ overscan
+        WRITE setOverscan NOTIFY overscanChanged FINAL )
+
+    Q_PROPERTY( qreal estimatedItemExtent READ estimatedItemExtent
+        WRITE setEstimatedItemExtent RESET resetEstimatedItemExtent
+        NOTIFY estimatedItemExtentChanged FINAL )
+
+    using Inherited = QskBox;
+
+  public:
+    explicit QskVirtualLinearBox( QQuickItem* parent = nullptr );
+    explicit QskVirtualLinearBox( Qt::Orientation, QQuickItem* parent = nullptr );
+
+    ~QskVirtualLinearBox() override;
+
+    void setOrientation( Qt::Orientation );
+    Qt::Orientation orientation() const;
+
+    void setCount( int );
+    int count() const;
+
+    void setSpacing( qreal );
+    qreal spacing() const;
+
+    // number of extra items before/after the viewport
+    void setOverscan( int );
+    int overscan() const;
+
+    // < 0: using the average extent of the measured items
+    void setEstimatedItemExtent( qreal );
+    void resetEstimatedItemExtent();
+    qreal estimatedItemExtent() const;
+
+    // nullptr, when no item is instantiated for index
+    QQuickItem* itemAtIndex( int index ) const;
+    int indexOf( const QQuickItem* ) const;
+
+    // according to the measured or estimated extents
+    QRectF geometryAt( int index ) const;
+
+  public Q_SLOTS:
+    void updateItems( int from, int to );
+    void resetItems();
+
+  Q_SIGNALS:
+    void orientationChanged();
+    void countChanged();
+    void spacingChanged();
+    void overscanChanged();
+    void estimatedItemExtentChanged();
+
+  protected:
+    bool event( QEvent* ) override;
+
+    void geometryChangeEvent( QskGeometryChangeEvent* ) override;
+    void viewportChangeEvent( QskViewportChangeEvent* ) override;
+
+    void updateLayout() override;
+    QSizeF layoutSizeHint( Qt::SizeHint, const QSizeF& ) const override;
+
+    virtual QQuickItem* createItem() = 0;
+    virtual void updateItem( QQuickItem*, int index ) = 0;
+
+  private:
+    QQuickItem* acquireItem( int index );
+    void releaseItem( QQuickItem* );
+
+    void measureItem( QQuickItem*, int index );
+    void layoutItems();
+
+    class PrivateData;
+    std::unique_ptr< PrivateData > m_data;
+};
+
+#endif
@@ -58,14 +58,15 @@ QskArcNode::~QskArcNode()
 {
 }
 
-void QskArcNode::setArcData( const QRectF& rect,
+void QskArcNode::setArcData( const QQuickWindow* window, const QRectF& rect,
     const QskArcMetrics& arcMetrics, const QskGradient& gradient )
 {
-    setArcData( rect, arcMetrics, 0.0, QColor(), gradient );
+    setArcData( window, rect, arcMetrics, 0.0, QColor(), gradient );
 }
 
-void QskArcNode::setArcData( const QRectF& rect, const QskArcMetrics& arcMetrics,
-    const qreal borderWidth, const QColor& borderColor, const QskGradient& gradient )
+void QskArcNode::setArcData( const QQuickWindow* window,
+    const QRectF& rect, const QskArcMetrics& arcMetrics, const qreal borderWidth,
+    const QColor& borderColor, const QskGradient& gradient )
 {
     using namespace QskSGNode;
 
@@ -95,14 +96,15 @@ void QskArcNode::setArcData( const QRectF& rect, const QskArcMetrics& arcMetrics
 
             if ( fillNode )
             {
-                arcNode->updateBorder( rect, metricsArc,
+                arcNode->updateBorder( window, rect, metricsArc,
                     radial, borderWidth, borderColor );
 
-                fillNode->updateFilling( rect, metricsArc, radial, borderWidth, gradient );
+                fillNode->updateFilling( window, rect,
+                    metricsArc, radial, borderWidth, gradient );
             }
             else
             {
-                arcNode->updateArc( rect, metricsArc,
+                arcNode->updateArc( window, rect, metricsArc,
                     radial, borderWidth, borderColor, gradient );
             }
         }
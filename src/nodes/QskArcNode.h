@@ -11,6 +11,7 @@
 
 class QskArcMetrics;
 class QskGradient;
+class QQuickWindow;
 
 class QSK_EXPORT QskArcNode : public QSGNode
 {
@@ -18,9 +19,10 @@ class QSK_EXPORT QskArcNode : public QSGNode
     QskArcNode();
     ~QskArcNode() override;
 
-    void setArcData( const QRectF&, const QskArcMetrics&, const QskGradient& );
+    void setArcData( const QQuickWindow*, const QRectF&,
+        const QskArcMetrics&, const QskGradient& );
 
-    void setArcData( const QRectF&, const QskArcMetrics&,
+    void setArcData( const QQuickWindow*, const QRectF&, const QskArcMetrics&,
         qreal borderWidth, const QColor& borderColor, const QskGradient& );
 };
 
@@ -10,7 +10,9 @@
 #include "QskGradient.h"
 #include "QskSGNode.h"
 #include "QskRgbValue.h"
+#include "QskTessellation.h"
 #include "QskFillNodePrivate.h"
+#include "QskGeometryJobs.h"
 
 static inline bool qskHasBorder( qreal width, const QColor& color )
 {
@@ -23,13 +25,15 @@ class QskArcRenderNodePrivate final : public QskFillNodePrivate
     inline void resetNode( QskArcRenderNode* node )
     {
         m_metricsHash = m_colorsHash = 0;
+
+        QskGeometryJobs::cancel( node );
         node->resetGeometry();
     }
 
-    inline bool updateMetrics( const QRectF& rect,
-        const QskArcMetrics& metrics, bool radial, qreal borderWidth )
+    inline bool updateMetrics( const QRectF& rect, const QskArcMetrics& metrics,
+        bool radial, qreal borderWidth, qreal devicePixelRatio )
     {
-        QskHashValue hash = 13000;
+        QskHashValue hash = QskTessellation::hash( devicePixelRatio, 13000 );
 
         hash = qHashBits( &rect, sizeof( rect ), hash );
         hash = metrics.hash( hash );
@@ -76,16 +80,17 @@ QskArcRenderNode::QskArcRenderNode()
 
 QskArcRenderNode::~QskArcRenderNode()
 {
+    QskGeometryJobs::cancel( this );
 }
 
-void QskArcRenderNode::updateFilling( const QRectF& rect,
-    const QskArcMetrics& metrics, const QskGradient& gradient )
+void QskArcRenderNode::updateFilling( const QQuickWindow* window,
+    const QRectF& rect, const QskArcMetrics& metrics, const QskGradient& gradient )
 {
-    updateFilling( rect, metrics, false, 0.0, gradient );
+    updateFilling( window, rect, metrics, false, 0.0, gradient );
 }
 
-void QskArcRenderNode::updateFilling( const QRectF& rect,
-    const QskArcMetrics& arcMetrics, bool radial,
+void QskArcRenderNode::updateFilling( const QQuickWindow* window,
+    const QRectF& rect, const QskArcMetrics& arcMetrics, bool radial,
     qreal borderWidth, const QskGradient& gradient )
 {
     Q_D( QskArcRenderNode );
@@ -116,7 +121,10 @@ void QskArcRenderNode::updateFilling( const QRectF& rect,
         coloredGeometry = ( gradient.type() == QskGradient::Stops );
     }
 
-    bool dirtyGeometry = d->updateMetrics( rect, metrics, radial, borderWidth );
+    const auto devicePixelRatio = QskTessellation::devicePixelRatio( window );
+
+    bool dirtyGeometry = d->updateMetrics(
+        rect, metrics, radial, borderWidth, devicePixelRatio );
     bool dirtyMaterial = d->updateColors( QColor(), gradient );
 
     if ( coloredGeometry != isGeometryColored() )
@@ -124,12 +132,19 @@ void QskArcRenderNode::updateFilling( const QRectF& rect,
 
     if ( dirtyGeometry || dirtyMaterial )
     {
+        auto geometry = this->geometry();
+
         if ( coloredGeometry )
         {
             setColoring( QskFillNode::Polychrome );
 
-            QskArcRenderer::setColoredFillLines( rect, metrics, radial,
-                borderWidth, gradient, *geometry() );
+            QskGeometryJobs::submit( window, this,
+                [=]()
+                {
+                    QskArcRenderer::setColoredFillLines( devicePixelRatio,
+                        rect, metrics, radial, borderWidth, gradient, *geometry );
+                }
+            );
 
             markDirty( QSGNode::DirtyGeometry );
         }
@@ -139,8 +154,13 @@ void QskArcRenderNode::updateFilling( const QRectF& rect,
 
             if ( dirtyGeometry )
             {
-                QskArcRenderer::setFillLines( rect, metrics,
-                    radial, borderWidth, *geometry() );
+                QskGeometryJobs::submit( window, this,
+                    [=]()
+                    {
+                        QskArcRenderer::setFillLines( devicePixelRatio,
+                            rect, metrics, radial, borderWidth, *geometry );
+                    }
+                );
 
                 markDirty( QSGNode::DirtyGeometry );
             }
@@ -148,8 +168,8 @@ void QskArcRenderNode::updateFilling( const QRectF& rect,
     }
 }
 
-void QskArcRenderNode::updateBorder( const QRectF& rect,
-    const QskArcMetrics& arcMetrics, bool radial,
+void QskArcRenderNode::updateBorder( const QQuickWindow* window,
+    const QRectF& rect, const QskArcMetrics& arcMetrics, bool radial,
     qreal borderWidth, const QColor& borderColor )
 {
     Q_D( QskArcRenderNode );
@@ -163,7 +183,10 @@ void QskArcRenderNode::updateBorder( const QRectF& rect,
 
     const bool coloredGeometry = hasHint( PreferColoredGeometry );
 
-    bool dirtyGeometry = d->updateMetrics( rect, arcMetrics, radial, borderWidth );
+    const auto devicePixelRatio = QskTessellation::devicePixelRatio( window );
+
+    bool dirtyGeometry = d->updateMetrics(
+        rect, arcMetrics, radial, borderWidth, devicePixelRatio );
     bool dirtyMaterial = d->updateColors( borderColor, QskGradient() );
 
     if ( coloredGeometry != isGeometryColored() )
@@ -174,12 +197,19 @@ void QskArcRenderNode::updateBorder( const QRectF& rect,
         const auto metrics = arcMetrics.toAbsolute( rect.size() );
         borderWidth = qMin( borderWidth, 0.5 * metrics.thickness() );
 
+        auto geometry = this->geometry();
+
         if ( coloredGeometry )
         {
             setColoring( QskFillNode::Polychrome );
 
-            QskArcRenderer::setColoredBorderLines( rect, metrics, radial,
-                borderWidth, borderColor, *geometry() );
+            QskGeometryJobs::submit( window, this,
+                [=]()
+                {
+                    QskArcRenderer::setColoredBorderLines( devicePixelRatio,
+                        rect, metrics, radial, borderWidth, borderColor, *geometry );
+                }
+            );
 
             markDirty( QSGNode::DirtyGeometry );
         }
@@ -189,8 +219,13 @@ void QskArcRenderNode::updateBorder( const QRectF& rect,
 
             if ( dirtyGeometry )
             {
-                QskArcRenderer::setBorderLines( rect, metrics, radial,
-                    borderWidth, *geometry() );
+                QskGeometryJobs::submit( window, this,
+                    [=]()
+                    {
+                        QskArcRenderer::setBorderLines( devicePixelRatio,
+                            rect, metrics, radial, borderWidth, *geometry );
+                    }
+                );
 
                 markDirty( QSGNode::DirtyGeometry );
             }
@@ -198,7 +233,7 @@ void QskArcRenderNode::updateBorder( const QRectF& rect,
     }
 }
 
-void QskArcRenderNode::updateArc(
+void QskArcRenderNode::updateArc( const QQuickWindow* window,
     const QRectF& rect, const QskArcMetrics& arcMetrics, bool radial,
     qreal borderWidth, const QColor& borderColor, const QskGradient& gradient )
 {
@@ -225,26 +260,37 @@ void QskArcRenderNode::updateArc(
          */
         borderWidth = qMin( borderWidth, borderMax );
 
-        const bool isDirty = d->updateMetrics( rect, arcMetrics, radial, borderWidth )
+        const auto devicePixelRatio = QskTessellation::devicePixelRatio( window );
+
+        const bool isDirty =
+            d->updateMetrics( rect, arcMetrics, radial, borderWidth, devicePixelRatio )
             || d->updateColors( borderColor, gradient ) || !isGeometryColored();
 
         if ( isDirty )
         {
             setColoring( QskFillNode::Polychrome );
 
-            QskArcRenderer::setColoredBorderAndFillLines( rect, metrics, radial,
-                borderWidth, borderColor, gradient, *geometry() );
+            auto geometry = this->geometry();
+
+            QskGeometryJobs::submit( window, this,
+                [=]()
+                {
+                    QskArcRenderer::setColoredBorderAndFillLines( devicePixelRatio,
+                        rect, metrics, radial, borderWidth, borderColor,
+                        gradient, *geometry );
+                }
+            );
 
             markDirty( QSGNode::DirtyGeometry );
         }
     }
     else if ( hasBorder )
     {
-        updateBorder( rect, arcMetrics, radial, borderWidth, borderColor );
+        updateBorder( window, rect, arcMetrics, radial, borderWidth, borderColor );
     }
     else if ( hasFill )
     {
-        updateFilling( rect, arcMetrics, radial, borderWidth, gradient );
+        updateFilling( window, rect, arcMetrics, radial, borderWidth, gradient );
     }
     else
     {
@@ -11,6 +11,7 @@
 
 class QskGradient;
 class QskArcMetrics;
+class QQuickWindow;
 
 class QskArcRenderNodePrivate;
 
@@ -22,14 +23,16 @@ class QSK_EXPORT QskArcRenderNode : public QskFillNode
     QskArcRenderNode();
     ~QskArcRenderNode() override;
 
-    void updateFilling( const QRectF&, const QskArcMetrics&, const QskGradient& );
-    void updateFilling( const QRectF&, const QskArcMetrics&, bool radial,
-        qreal borderWidth, const QskGradient& );
+    void updateFilling( const QQuickWindow*, const QRectF&,
+        const QskArcMetrics&, const QskGradient& );
 
-    void updateBorder( const QRectF&, const QskArcMetrics&, bool radial,
-        qreal borderWidth, const QColor& borderColor );
+    void updateFilling( const QQuickWindow*, const QRectF&, const QskArcMetrics&,
+        bool radial, qreal borderWidth, const QskGradient& );
 
-    void updateArc( const QRectF&, const QskArcMetrics&, bool radial,
+    void updateBorder( const QQuickWindow*, const QRectF&, const QskArcMetrics&,
+        bool radial, qreal borderWidth, const QColor& borderColor );
+
+    void updateArc( const QQuickWindow*, const QRectF&, const QskArcMetrics&, bool radial,
         qreal borderWidth, const QColor& borderColor, const QskGradient& );
 
   private:
@@ -8,6 +8,7 @@
 #include "QskGradient.h"
 #include "QskVertex.h"
 #include "QskVertexHelper.h"
+#include "QskTessellation.h"
 #include "QskRgbValue.h"
 
 #include <qsggeometry.h>
@@ -276,7 +277,7 @@ namespace
     class Renderer
     {
       public:
-        Renderer( const QRectF&, const QskArcMetrics&,
+        Renderer( qreal devicePixelRatio, const QRectF&, const QskArcMetrics&,
             bool radial, const QskGradient&, const QskVertex::Color& );
 
         int fillCount() const;
@@ -301,10 +302,13 @@ namespace
 
         const QskGradient& m_gradient;
         const QskVertex::Color m_borderColor;
+
+        int m_lineCount;
     };
 
-    Renderer::Renderer( const QRectF& rect, const QskArcMetrics& metrics,
-            bool radial, const QskGradient& gradient, const QskVertex::Color& borderColor )
+    Renderer::Renderer( qreal devicePixelRatio,
+            const QRectF& rect, const QskArcMetrics& metrics, bool radial,
+            const QskGradient& gradient, const QskVertex::Color& borderColor )
         : m_rect( rect )
         , m_radians1( qDegreesToRadians( metrics.startAngle() ) )
         , m_radians2( qDegreesToRadians( metrics.endAngle() ) )
@@ -313,17 +317,17 @@ namespace
         , m_gradient( gradient )
         , m_borderColor( borderColor )
     {
+        const auto radius = 0.5 * qMax( m_rect.width(), m_rect.height() );
+
+        const auto segmentCount = QskTessellation::arcSegmentCount( radius,
+            m_radians2 - m_radians1, devicePixelRatio );
+
+        m_lineCount = segmentCount + 1;
     }
 
     int Renderer::arcLineCount() const
     {
-        // not very sophisticated - TODO ...
-
-        const auto radius = 0.5 * qMax( m_rect.width(), m_rect.height() );
-        const auto radians = qAbs( m_radians2 - m_radians1 );
-
-        const auto count = qCeil( ( radius * radians ) / 3.0 );
-        return qBound( 3, count, 160 );
+        return m_lineCount;
     }
 
     int Renderer::fillCount() const
@@ -484,9 +488,9 @@ bool QskArcRenderer::isGradientSupported( const QRectF& rect,
     return false;
 }
 
-void QskArcRenderer::setColoredBorderLines( const QRectF& rect,
-    const QskArcMetrics& metrics, bool radial, qreal borderWidth,
-    const QColor& borderColor, QSGGeometry& geometry )
+void QskArcRenderer::setColoredBorderLines( qreal devicePixelRatio,
+    const QRectF& rect, const QskArcMetrics& metrics, bool radial,
+    qreal borderWidth, const QColor& borderColor, QSGGeometry& geometry )
 {
     geometry.setDrawingMode( QSGGeometry::DrawTriangleStrip );
     geometry.markVertexDataDirty();
@@ -497,7 +501,8 @@ void QskArcRenderer::setColoredBorderLines( const QRectF& rect,
         return;
     }
 
-    const Renderer renderer( rect, metrics, radial, QskGradient(), borderColor );
+    const Renderer renderer( devicePixelRatio, rect, metrics,
+        radial, QskGradient(), borderColor );
 
     if ( const auto lines = qskAllocateColoredLines( geometry, renderer.borderCount() ) )
     {
@@ -506,7 +511,8 @@ void QskArcRenderer::setColoredBorderLines( const QRectF& rect,
     }
 }
 
-void QskArcRenderer::setColoredFillLines( const QRectF& rect, const QskArcMetrics& metrics,
+void QskArcRenderer::setColoredFillLines( qreal devicePixelRatio,
+    const QRectF& rect, const QskArcMetrics& metrics,
     bool radial, qreal borderWidth, const QskGradient& gradient, QSGGeometry& geometry )
 {
     geometry.setDrawingMode( QSGGeometry::DrawTriangleStrip );
@@ -518,7 +524,8 @@ void QskArcRenderer::setColoredFillLines( const QRectF& rect, const QskArcMetric
         return;
     }
 
-    const Renderer renderer( rect, metrics, radial, gradient, QColor( 0, 0, 0, 0 ) );
+    const Renderer renderer( devicePixelRatio, rect, metrics,
+        radial, gradient, QColor( 0, 0, 0, 0 ) );
 
     if ( const auto lines = qskAllocateColoredLines( geometry, renderer.fillCount() ) )
     {
@@ -527,14 +534,14 @@ void QskArcRenderer::setColoredFillLines( const QRectF& rect, const QskArcMetric
     }
 }
 
-void QskArcRenderer::setColoredBorderAndFillLines( const QRectF& rect,
-    const QskArcMetrics& metrics, bool radial, qreal borderWidth,
+void QskArcRenderer::setColoredBorderAndFillLines( qreal devicePixelRatio,
+    const QRectF& rect, const QskArcMetrics& metrics, bool radial, qreal borderWidth,
     const QColor& borderColor,  const QskGradient& gradient, QSGGeometry& geometry )
 {
     geometry.setDrawingMode( QSGGeometry::DrawTriangleStrip );
     geometry.markVertexDataDirty();
 
-    const Renderer renderer( rect, metrics, radial, gradient,
+    const Renderer renderer( devicePixelRatio, rect, metrics, radial, gradient,
         borderColor.isValid() ? borderColor : QColor( 0, 0, 0, 0 ) );
 
     const auto borderCount = renderer.borderCount();
@@ -562,7 +569,7 @@ void QskArcRenderer::setColoredBorderAndFillLines( const QRectF& rect,
     }
 }
 
-void QskArcRenderer::setBorderLines( const QRectF& rect,
+void QskArcRenderer::setBorderLines( qreal devicePixelRatio, const QRectF& rect,
     const QskArcMetrics& metrics, bool radial, qreal borderWidth, QSGGeometry& geometry )
 {
     geometry.setDrawingMode( QSGGeometry::DrawTriangleStrip );
@@ -574,7 +581,8 @@ void QskArcRenderer::setBorderLines( const QRectF& rect,
         return;
     }
 
-    const Renderer renderer( rect, metrics, radial, QskGradient(), QskRgb::Black );
+    const Renderer renderer( devicePixelRatio, rect, metrics,
+        radial, QskGradient(), QskRgb::Black );
 
     const auto lines = qskAllocateLines( geometry, renderer.borderCount() );
     if ( lines )
@@ -584,13 +592,13 @@ void QskArcRenderer::setBorderLines( const QRectF& rect,
     }
 }
 
-void QskArcRenderer::setFillLines( const QRectF& rect,
+void QskArcRenderer::setFillLines( qreal devicePixelRatio, const QRectF& rect,
     const QskArcMetrics& metrics, bool radial, qreal borderWidth, QSGGeometry& geometry )
 {
     geometry.setDrawingMode( QSGGeometry::DrawTriangleStrip );
     geometry.markVertexDataDirty();
 
-    const Renderer renderer( rect, metrics, radial, QskRgb::Black, 0 );
+    const Renderer renderer( devicePixelRatio, rect, metrics, radial, QskRgb::Black, 0 );
 
     const auto lines = qskAllocateLines( geometry, renderer.fillCount() );
     if ( lines )
@@ -599,3 +607,41 @@ void QskArcRenderer::setFillLines( const QRectF& rect,
         renderer.renderArc( metrics.thickness(), borderWidth, lines, border );
     }
 }
+
+void QskArcRenderer::setBorderLines( const QQuickWindow* window, const QRectF& rect,
+    const QskArcMetrics& metrics, bool radial, qreal borderWidth, QSGGeometry& geometry )
+{
+    setBorderLines( QskTessellation::devicePixelRatio( window ),
+        rect, metrics, radial, borderWidth, geometry );
+}
+
+void QskArcRenderer::setFillLines( const QQuickWindow* window, const QRectF& rect,
+    const QskArcMetrics& metrics, bool radial, qreal borderWidth, QSGGeometry& geometry )
+{
+    setFillLines( QskTessellation::devicePixelRatio( window ),
+        rect, metrics, radial, borderWidth, geometry );
+}
+
+void QskArcRenderer::setColoredBorderLines( const QQuickWindow* window,
+    const QRectF& rect, const QskArcMetrics& metrics, bool radial,
+    qreal borderWidth, const QColor& borderColor, QSGGeometry& geometry )
+{
+    setColoredBorderLines( QskTessellation::devicePixelRatio( window ),
+        rect, metrics, radial, borderWidth, borderColor, geometry );
+}
+
+void QskArcRenderer::setColoredFillLines( const QQuickWindow* window,
+    const QRectF& rect, const QskArcMetrics& metrics,
+    bool radial, qreal borderWidth, const QskGradient& gradient, QSGGeometry& geometry )
+{
+    setColoredFillLines( QskTessellation::devicePixelRatio( window ),
+        rect, metrics, radial, borderWidth, gradient, geometry );
+}
+
+void QskArcRenderer::setColoredBorderAndFillLines( const QQuickWindow* window,
+    const QRectF& rect, const QskArcMetrics& metrics, bool radial, qreal borderWidth,
+    const QColor& borderColor, const QskGradient& gradient, QSGGeometry& geometry )
+{
+    setColoredBorderAndFillLines( QskTessellation::devicePixelRatio( window ),
+        rect, metrics, radial, borderWidth, borderColor, gradient, geometry );
+}
@@ -12,6 +12,7 @@ class QskArcMetrics;
 class QskGradient;
 
 class QSGGeometry;
+class QQuickWindow;
 class QRectF;
 class QColor;
 
@@ -23,12 +24,22 @@ namespace QskArcRenderer
 
         - clip nodes
         - using shaders setting the colors
+
+        The window is needed for the device pixel ratio, that affects
+        the number of segments: see QskTessellation. The overloads
+        taking the ratio can be called from worker threads.
      */
 
-    QSK_EXPORT void setBorderLines( const QRectF&,
+    QSK_EXPORT void setBorderLines( const QQuickWindow*, const QRectF&,
+        const QskArcMetrics&, bool radial, qreal borderWidth, QSGGeometry& );
+
+    QSK_EXPORT void setBorderLines( qreal devicePixelRatio, const QRectF&,
         const QskArcMetrics&, bool radial, qreal borderWidth, QSGGeometry& );
 
-    QSK_EXPORT void setFillLines( const QRectF&,
+    QSK_EXPORT void setFillLines( const QQuickWindow*, const QRectF&,
+        const QskArcMetrics&, bool radial, qreal borderWidth, QSGGeometry& );
+
+    QSK_EXPORT void setFillLines( qreal devicePixelRatio, const QRectF&,
         const QskArcMetrics&, bool radial, qreal borderWidth, QSGGeometry& );
 
     /*
@@ -40,15 +51,27 @@ namespace QskArcRenderer
     QSK_EXPORT bool isGradientSupported(
         const QRectF&, const QskArcMetrics&, const QskGradient& );
 
-    QSK_EXPORT void setColoredBorderLines( const QRectF&,
+    QSK_EXPORT void setColoredBorderLines( const QQuickWindow*, const QRectF&,
+        const QskArcMetrics&, bool radial, qreal borderWidth,
+        const QColor& borderColor, QSGGeometry& );
+
+    QSK_EXPORT void setColoredBorderLines( qreal devicePixelRatio, const QRectF&,
         const QskArcMetrics&, bool radial, qreal borderWidth,
         const QColor& borderColor, QSGGeometry& );
 
-    QSK_EXPORT void setColoredFillLines( const QRectF&,
+    QSK_EXPORT void setColoredFillLines( const QQuickWindow*, const QRectF&,
+        const QskArcMetrics&, bool radial, qreal borderWidth,
+        const QskGradient&, QSGGeometry& );
+
+    QSK_EXPORT void setColoredFillLines( qreal devicePixelRatio, const QRectF&,
         const QskArcMetrics&, bool radial, qreal borderWidth,
         const QskGradient&, QSGGeometry& );
 
-    QSK_EXPORT void setColoredBorderAndFillLines( const QRectF&,
+    QSK_EXPORT void setColoredBorderAndFillLines( const QQuickWindow*, const QRectF&,
+        const QskArcMetrics&, bool radial, qreal borderWidth,
+        const QColor& borderColor, const QskGradient&, QSGGeometry& );
+
+    QSK_EXPORT void setColoredBorderAndFillLines( qreal devicePixelRatio, const QRectF&,
         const QskArcMetrics&, bool radial, qreal borderWidth,
         const QColor& borderColor, const QskGradient&, QSGGeometry& );
 }
@@ -4,6 +4,7 @@
  *****************************************************************************/
 
 #include "QskBasicLinesNode.h"
+#include "QskStippleMetrics.h"
 #include "QskInternalMacros.h"
 
 #include <qsgmaterial.h>
@@ -29,6 +30,44 @@ static inline QVector2D qskOrigin(
     );
 }
 
+/*
+    The dash pattern is passed as cumulated positions, where the dashes/gaps
+    end. For a position on the line the fragment shader finds the matching
+    dash or gap - what makes the geometry independent of the number of dashes.
+ */
+static constexpr int qskMaxDashCount = 8;
+
+static inline bool qskDashPattern( const QskStippleMetrics& metrics,
+    float positions[], float& period )
+{
+    if ( !metrics.isValid() || metrics.isSolid() )
+        return false;
+
+    auto pattern = metrics.pattern();
+    if ( pattern.count() % 2 )
+    {
+        // dashes and gaps are swapped in the following period
+        const auto p = pattern;
+        pattern += p;
+    }
+
+    if ( pattern.count() > qskMaxDashCount )
+        return false;
+
+    period = 0.0f;
+
+    for ( int i = 0; i < pattern.count(); i++ )
+    {
+        period += std::max( static_cast< float >( pattern[i] ), 0.0f );
+        positions[i] = period;
+    }
+
+    for ( int i = pattern.count(); i < qskMaxDashCount; i++ )
+        positions[i] = period;
+
+    return period > 0.0f;
+}
+
 #if QT_VERSION < QT_VERSION_CHECK( 6, 0, 0 )
     #include <QSGMaterialRhiShader>
     using RhiShader = QSGMaterialRhiShader;
@@ -41,7 +80,7 @@ namespace
     class Material final : public QSGMaterial
     {
       public:
-        Material();
+        Material( bool isStippled );
 
 #if QT_VERSION < QT_VERSION_CHECK( 6, 0, 0 )
         QSGMaterialShader* createShader() const override;
@@ -53,20 +92,29 @@ namespace
 
         int compare( const QSGMaterial* other ) const override;
 
+        bool hasSameDashes( const Material& ) const;
+
         QColor m_color = QColor( 255, 255, 255 );
         Qt::Orientations m_pixelAlignment;
+
+        const bool m_isStippled;
+
+        float m_dashOffset = 0.0f;
+        float m_dashPeriod = 0.0f;
+        float m_dashes[ qskMaxDashCount ] = {};
     };
 
     class ShaderRhi final : public RhiShader
     {
       public:
 
-        ShaderRhi()
+        ShaderRhi( bool isStippled )
         {
             const QString root( ":/qskinny/shaders/" );
+            const QString name( isStippled ? "stippledlines" : "crisplines" );
 
-            setShaderFileName( VertexStage, root + "crisplines.vert.qsb" );
-            setShaderFileName( FragmentStage, root + "crisplines.frag.qsb" );
+            setShaderFileName( VertexStage, root + name + ".vert.qsb" );
+            setShaderFileName( FragmentStage, root + name + ".frag.qsb" );
         }
 
         bool updateUniformData( RenderState& state,
@@ -113,6 +161,20 @@ namespace
                 changed = true;
             }
 
+            if ( matNew->m_isStippled )
+            {
+                if ( ( matOld == nullptr ) || !matNew->hasSameDashes( *matOld ) )
+                {
+                    Q_ASSERT( state.uniformData()->size() >= 128 );
+
+                    memcpy( data + 88, &matNew->m_dashOffset, 4 );
+                    memcpy( data + 92, &matNew->m_dashPeriod, 4 );
+                    memcpy( data + 96, matNew->m_dashes, 4 * qskMaxDashCount );
+
+                    changed = true;
+                }
+            }
+
             return changed;
         }
     };
@@ -127,21 +189,36 @@ namespace
     class ShaderGL final : public QSGMaterialShader
     {
       public:
-        ShaderGL()
+        ShaderGL( bool isStippled )
+            : m_isStippled( isStippled )
         {
             const QString root( ":/qskinny/shaders/" );
 
-            setShaderSourceFile( QOpenGLShader::Vertex,
-                ":/qskinny/shaders/crisplines.vert" );
+            if ( isStippled )
+            {
+                setShaderSourceFile( QOpenGLShader::Vertex,
+                    ":/qskinny/shaders/stippledlines.vert" );
+
+                setShaderSourceFile( QOpenGLShader::Fragment,
+                    ":/qskinny/shaders/stippledlines.frag" );
+            }
+            else
+            {
+                setShaderSourceFile( QOpenGLShader::Vertex,
+                    ":/qskinny/shaders/crisplines.vert" );
 
-            setShaderSourceFile( QOpenGLShader::Fragment,
-                ":/qt-project.org/scenegraph/shaders/flatcolor.frag" );
+                setShaderSourceFile( QOpenGLShader::Fragment,
+                    ":/qt-project.org/scenegraph/shaders/flatcolor.frag" );
+            }
         }
 
         char const* const* attributeNames() const override
         {
             static char const* const names[] = { "in_vertex", nullptr };
-            return names;
+            static char const* const stippledNames[] =
+                { "in_vertex", "in_stippleCoord", nullptr };
+
+            return m_isStippled ? stippledNames : names;
         }
 
         void initialize() override
@@ -153,6 +230,13 @@ namespace
             m_matrixId = p->uniformLocation( "matrix" );
             m_colorId = p->uniformLocation( "color" );
             m_originId = p->uniformLocation( "origin" );
+
+            if ( m_isStippled )
+            {
+                m_dashOffsetId = p->uniformLocation( "dashOffset" );
+                m_dashPeriodId = p->uniformLocation( "dashPeriod" );
+                m_dashesId = p->uniformLocation( "dashes" );
+            }
         }
 
         void updateState( const QSGMaterialShader::RenderState& state,
@@ -180,19 +264,34 @@ namespace
                 const auto origin = qskOrigin(
                     state.viewportRect(), material->m_pixelAlignment );;
                 p->setUniformValue( m_originId, origin );
+
+                if ( m_isStippled )
+                {
+                    p->setUniformValue( m_dashOffsetId, material->m_dashOffset );
+                    p->setUniformValue( m_dashPeriodId, material->m_dashPeriod );
+                    p->setUniformValueArray( m_dashesId,
+                        material->m_dashes, qskMaxDashCount / 4, 4 );
+                }
             }
         }
 
       private:
+        const bool m_isStippled;
+
         int m_matrixId = -1;
         int m_colorId = -1;
         int m_originId = -1;
+
+        int m_dashOffsetId = -1;
+        int m_dashPeriodId = -1;
+        int m_dashesId = -1;
     };
 }
 
 #endif
 
-Material::Material()
+Material::Material( bool isStippled )
+    : m_isStippled( isStippled )
 {
 #if QT_VERSION < QT_VERSION_CHECK( 6, 0, 0 )
     setFlag( QSGMaterial::SupportsRhiShader, true );
@@ -204,24 +303,26 @@ Material::Material()
 QSGMaterialShader* Material::createShader() const
 {
     if ( !( flags() & QSGMaterial::RhiShaderWanted ) )
-        return new ShaderGL();
+        return new ShaderGL( m_isStippled );
 
-    return new ShaderRhi();
+    return new ShaderRhi( m_isStippled );
 }
 
 #else
 
 QSGMaterialShader* Material::createShader( QSGRendererInterface::RenderMode ) const
 {
-    return new ShaderRhi();
+    return new ShaderRhi( m_isStippled );
 }
 
 #endif
 
 QSGMaterialType* Material::type() const
 {
-    static QSGMaterialType staticType;
-    return &staticType;
+    static QSGMaterialType solidType;
+    static QSGMaterialType stippledType;
+
+    return m_isStippled ? &stippledType : &solidType;
 }
 
 int Material::compare( const QSGMaterial* other ) const
@@ -229,7 +330,8 @@ int Material::compare( const QSGMaterial* other ) const
     auto material = static_cast< const Material* >( other );
 
     if ( ( material->m_color == m_color )
-        && ( material->m_pixelAlignment == m_pixelAlignment ) )
+        && ( material->m_pixelAlignment == m_pixelAlignment )
+        && hasSameDashes( *material ) )
     {
         return 0;
     }
@@ -237,17 +339,41 @@ int Material::compare( const QSGMaterial* other ) const
     return QSGMaterial::compare( other );
 }
 
+bool Material::hasSameDashes( const Material& other ) const
+{
+    if ( !m_isStippled )
+        return true;
+
+    return ( m_dashOffset == other.m_dashOffset )
+        && ( m_dashPeriod == other.m_dashPeriod )
+        && ( memcmp( m_dashes, other.m_dashes, sizeof( m_dashes ) ) == 0 );
+}
+
 class QskBasicLinesNodePrivate final : public QSGGeometryNodePrivate
 {
   public:
     QskBasicLinesNodePrivate()
         : geometry( QSGGeometry::defaultAttributes_Point2D(), 0 )
+        , stippledGeometry( QSGGeometry::defaultAttributes_TexturedPoint2D(), 0 )
+        , material( false )
+        , stippledMaterial( true )
     {
         geometry.setDrawingMode( QSGGeometry::DrawLines );
+        stippledGeometry.setDrawingMode( QSGGeometry::DrawLines );
+    }
+
+    inline Material& effectiveMaterial()
+    {
+        return isStippled ? stippledMaterial : material;
     }
 
     QSGGeometry geometry;
+    QSGGeometry stippledGeometry;
+
     Material material;
+    Material stippledMaterial;
+
+    bool isStippled = false;
 };
 
 QskBasicLinesNode::QskBasicLinesNode()
@@ -270,6 +396,8 @@ void QskBasicLinesNode::setPixelAlignment( Qt::Orientations orientations )
     if ( orientations != d->material.m_pixelAlignment )
     {
         d->material.m_pixelAlignment = orientations;
+        d->stippledMaterial.m_pixelAlignment = orientations;
+
         markDirty( QSGNode::DirtyMaterial );
     }
 }
@@ -279,6 +407,63 @@ Qt::Orientations QskBasicLinesNode::pixelAlignment() const
     return d_func()->material.m_pixelAlignment;
 }
 
+bool QskBasicLinesNode::setStippleMetrics( const QskStippleMetrics& metrics )
+{
+    Q_D( QskBasicLinesNode );
+
+    auto& m = d->stippledMaterial;
+
+    float dashes[ qskMaxDashCount ];
+    float period;
+
+    const bool isStippled = qskDashPattern( metrics, dashes, period );
+
+    if ( isStippled )
+    {
+        const float offset = metrics.offset();
+
+        if ( ( offset != m.m_dashOffset ) || ( period != m.m_dashPeriod )
+            || memcmp( dashes, m.m_dashes, sizeof( dashes ) ) != 0 )
+        {
+            m.m_dashOffset = offset;
+            m.m_dashPeriod = period;
+            memcpy( m.m_dashes, dashes, sizeof( dashes ) );
+
+            if ( d->isStippled )
+                markDirty( QSGNode::DirtyMaterial );
+        }
+    }
+
+    if ( isStippled != d->isStippled )
+    {
+        d->isStippled = isStippled;
+
+        setGeometry( isStippled ? &d->stippledGeometry : &d->geometry );
+        setMaterial( &d->effectiveMaterial() );
+
+        /*
+            The geometry we are switching to is outdated. Clearing
+            it avoids that it is rendered before being updated.
+         */
+        geometry()->allocate( 0 );
+    }
+
+    return isStippled;
+}
+
+bool QskBasicLinesNode::isStippled() const
+{
+    return d_func()->isStippled;
+}
+
+bool QskBasicLinesNode::isStippleSupported( const QskStippleMetrics& metrics )
+{
+    float dashes[ qskMaxDashCount ];
+    float period;
+
+    return qskDashPattern( metrics, dashes, period );
+}
+
 void QskBasicLinesNode::setColor( const QColor& color )
 {
     Q_D( QskBasicLinesNode );
@@ -287,6 +472,8 @@ void QskBasicLinesNode::setColor( const QColor& color )
     if ( c != d->material.m_color )
     {
         d->material.m_color = c;
+        d->stippledMaterial.m_color = c;
+
         markDirty( QSGNode::DirtyMaterial );
     }
 }
@@ -302,7 +489,10 @@ void QskBasicLinesNode::setLineWidth( float lineWidth )
 
     lineWidth = std::max( lineWidth, 0.0f );
     if( lineWidth != d->geometry.lineWidth() )
+    {
         d->geometry.setLineWidth( lineWidth );
+        d->stippledGeometry.setLineWidth( lineWidth );
+    }
 }
 
 float QskBasicLinesNode::lineWidth() const
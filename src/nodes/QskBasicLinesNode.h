@@ -12,12 +12,17 @@
 #include <qnamespace.h>
 
 class QColor;
+class QskStippleMetrics;
 
 class QskBasicLinesNodePrivate;
 
 /*
     A node for stippled or solid lines.
-    For the moment limited to horizontal/vertical lines: TODO
+
+    Stippled lines are rendered as solid lines, where the dashes are
+    calculated in the fragment shader. The geometry has to provide the
+    position along the line as x coordinate of the texture position
+    ( QSGGeometry::TexturedPoint2D ) then.
  */
 class QSK_EXPORT QskBasicLinesNode : public QSGGeometryNode
 {
@@ -36,6 +41,17 @@ class QSK_EXPORT QskBasicLinesNode : public QSGGeometryNode
     void setLineWidth( float );
     float lineWidth() const;
 
+    /*
+        Switches between a geometry with QSGGeometry::Point2D or
+        QSGGeometry::TexturedPoint2D vertices. Returns false,
+        when the dashes can't be done in the shader: solid lines or
+        patterns with more than 8 entries.
+     */
+    bool setStippleMetrics( const QskStippleMetrics& );
+    bool isStippled() const;
+
+    static bool isStippleSupported( const QskStippleMetrics& );
+
   private:
     Q_DECLARE_PRIVATE( QskBasicLinesNode )
 };
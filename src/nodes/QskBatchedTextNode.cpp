@@ -0,0 +1,187 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) The authors
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#include "QskBatchedTextNode.h"
+#include "QskGlyphNodes.h"
+#include "QskPlainTextRenderer.h"
+
+#include <qglyphrun.h>
+#include <qrawfont.h>
+
+namespace
+{
+    /*
+        The glyph nodes are using 16 bit indices with 4 vertices
+        for each glyph. So we have to split larger batches.
+     */
+    constexpr int qskMaxGlyphsPerRun = 8192;
+
+    class Batch
+    {
+      public:
+        inline bool matches( const QGlyphRun& run,
+            const QskBatchedTextNode::Text& text ) const
+        {
+            return ( glyphCount + run.glyphIndexes().count() <= qskMaxGlyphsPerRun )
+                && ( rawFont == run.rawFont() ) && ( flags == run.flags() )
+                && ( color == text.color ) && ( style == text.style )
+                && ( styleColor == text.styleColor )
+                && ( renderType == text.options.renderType() );
+        }
+
+        QRawFont rawFont;
+        QGlyphRun::GlyphRunFlags flags;
+
+        QColor color;
+        Qsk::TextStyle style;
+        QColor styleColor;
+
+        QskTextOptions::RenderType renderType;
+
+        QVector< quint32 > glyphIndexes;
+        QVector< QPointF > positions;
+        QRectF boundingRect;
+
+        int glyphCount = 0;
+    };
+}
+
+static inline QskHashValue qskTextHash(
+    const QskBatchedTextNode::Text& text, QskHashValue seed )
+{
+    auto hash = qHash( text.text, seed );
+    hash = qHashBits( &text.rect, sizeof( text.rect ), hash );
+    hash = qHash( text.font, hash );
+    hash = text.options.hash( hash );
+    hash = qHash( text.alignment, hash );
+    hash = qHash( text.color.rgba(), hash );
+    hash = qHash( text.style, hash );
+    hash = qHash( text.styleColor.rgba(), hash );
+
+    return hash;
+}
+
+QskBatchedTextNode::QskBatchedTextNode()
+    : m_hash( 0 )
+{
+}
+
+QskBatchedTextNode::~QskBatchedTextNode()
+{
+}
+
+void QskBatchedTextNode::updateNode(
+    const QQuickItem* item, const QVector< Text >& texts )
+{
+    QskHashValue hash = 12000;
+    for ( const auto& text : texts )
+        hash = qskTextHash( text, hash );
+
+    if ( hash == m_hash )
+        return;
+
+    m_hash = hash;
+
+    QVector< Batch > batches;
+
+    for ( const auto& text : texts )
+    {
+        if ( text.text.isEmpty() || text.rect.isEmpty() )
+            continue;
+
+        if ( !( text.color.isValid() && text.color.alpha() > 0 ) )
+            continue;
+
+        const auto glyphRuns = QskPlainTextRenderer::glyphRuns(
+            text.text, text.font, text.options, text.alignment, text.rect );
+
+        for ( const auto& run : glyphRuns )
+        {
+            if ( run.isEmpty() )
+                continue;
+
+            /*
+                Usually all cells share the same font and colors,
+                so we end up with very few batches.
+             */
+            Batch* batch = nullptr;
+
+            for ( auto& b : batches )
+            {
+                if ( b.matches( run, text ) )
+                {
+                    batch = &b;
+                    break;
+                }
+            }
+
+            if ( batch == nullptr )
+            {
+                batches.append( Batch() );
+
+                batch = &batches.last();
+                batch->rawFont = run.rawFont();
+                batch->flags = run.flags();
+                batch->color = text.color;
+                batch->style = text.style;
+                batch->styleColor = text.styleColor;
+                batch->renderType = text.options.renderType();
+            }
+
+            batch->glyphIndexes += run.glyphIndexes();
+            batch->positions += run.positions();
+            batch->boundingRect |= run.boundingRect();
+            batch->glyphCount += run.glyphIndexes().count();
+        }
+    }
+
+    auto node = firstChild();
+
+    for ( const auto& batch : std::as_const( batches ) )
+    {
+        QGlyphRun run;
+        run.setRawFont( batch.rawFont );
+        run.setFlags( batch.flags );
+        run.setGlyphIndexes( batch.glyphIndexes );
+        run.setPositions( batch.positions );
+        run.setBoundingRect( batch.boundingRect );
+
+        auto glyphNode = QskGlyphNodes::updateNode( item, node, run, QPointF(),
+            batch.color, batch.style, batch.styleColor, batch.renderType );
+
+        if ( glyphNode != node )
+        {
+            if ( node )
+            {
+                // the render type has changed
+                insertChildNodeAfter( glyphNode, node );
+                removeChildNode( node );
+                delete node;
+            }
+            else
+            {
+                appendChildNode( glyphNode );
+            }
+        }
+
+        node = glyphNode->nextSibling();
+    }
+
+    while ( node )
+    {
+        auto sibling = node->nextSibling();
+
+        removeChildNode( node );
+        delete node;
+
+        node = sibling;
+    }
+}
+
+bool QskBatchedTextNode::isBatchable( const QskTextOptions& options )
+{
+    return ( options.format() == QskTextOptions::PlainText )
+        && ( options.fontSizeMode() == QskTextOptions::FixedSize );
+}
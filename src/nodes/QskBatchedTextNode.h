@@ -0,0 +1,64 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) The authors
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#ifndef QSK_BATCHED_TEXT_NODE_H
+#define QSK_BATCHED_TEXT_NODE_H
+
+#include "QskNamespace.h"
+#include "QskTextOptions.h"
+
+#include <qcolor.h>
+#include <qfont.h>
+#include <qrect.h>
+#include <qsgnode.h>
+#include <qstring.h>
+#include <qvector.h>
+
+class QQuickItem;
+
+/*
+    A node for many short plain texts: f.e the cells of a list view.
+
+    The glyphs of all texts sharing the same font and colors are merged
+    into one glyph run, so that N texts end up in a few glyph nodes
+    instead of N transform nodes with a glyph node each.
+
+    The price is, that any change of one of the texts - or scrolling -
+    requires to rebuild the glyph geometry of all texts, while the
+    layouts of the texts are taken from the text cache.
+ */
+class QSK_EXPORT QskBatchedTextNode : public QSGNode
+{
+    using Inherited = QSGNode;
+
+  public:
+    class Text
+    {
+      public:
+        QString text;
+        QRectF rect;
+
+        QFont font;
+        QskTextOptions options;
+        Qt::Alignment alignment;
+
+        QColor color;
+        Qsk::TextStyle style = Qsk::Normal;
+        QColor styleColor;
+    };
+
+    QskBatchedTextNode();
+    ~QskBatchedTextNode() override;
+
+    void updateNode( const QQuickItem*, const QVector< Text >& );
+
+    // rich texts and fonts being adjusted to the rectangle can't be batched
+    static bool isBatchable( const QskTextOptions& );
+
+  private:
+    QskHashValue m_hash;
+};
+
+#endif
@@ -9,8 +9,8 @@
 #include "QskVertexHelper.h"
 #include "QskFunctions.h"
 
-QskBoxMetrics::QskBoxMetrics( const QRectF& rect,
-        const QskBoxShapeMetrics& shape, const QskBoxBorderMetrics& border )
+QskBoxMetrics::QskBoxMetrics( const QRectF& rect, const QskBoxShapeMetrics& shape,
+        const QskBoxBorderMetrics& border, qreal devicePixelRatio )
     : outerRect( rect )
 {
     isOutsideRounded = !shape.isRectangle();
@@ -59,7 +59,8 @@ QskBoxMetrics::QskBoxMetrics( const QRectF& rect,
 
         c.radiusX = qBound( 0.0, radius.width(), 0.5 * outerRect.width() );
         c.radiusY = qBound( 0.0, radius.height(), 0.5 * outerRect.height() );
-        c.stepCount = QskVertex::ArcIterator::segmentHint( qMax( c.radiusX, c.radiusY ) );
+        c.stepCount = QskVertex::ArcIterator::segmentHint(
+            qMax( c.radiusX, c.radiusY ), devicePixelRatio );
 
         switch ( i )
         {
@@ -16,8 +16,8 @@ class QskBoxBorderMetrics;
 class QskBoxMetrics
 {
   public:
-    QskBoxMetrics( const QRectF&,
-        const QskBoxShapeMetrics&, const QskBoxBorderMetrics& );
+    QskBoxMetrics( const QRectF&, const QskBoxShapeMetrics&,
+        const QskBoxBorderMetrics&, qreal devicePixelRatio = 1.0 );
 
     const QRectF outerRect;
     QRectF innerRect;
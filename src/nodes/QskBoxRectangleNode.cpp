@@ -10,6 +10,8 @@
 #include "QskBoxShapeMetrics.h"
 #include "QskGradient.h"
 #include "QskGradientDirection.h"
+#include "QskGeometryJobs.h"
+#include "QskTessellation.h"
 #include "QskFillNodePrivate.h"
 
 static inline bool qskHasBorder(
@@ -24,13 +26,15 @@ class QskBoxRectangleNodePrivate final : public QskFillNodePrivate
     inline void resetNode( QskBoxRectangleNode* node )
     {
         m_metricsHash = m_colorsHash = 0;
+
+        QskGeometryJobs::cancel( node );
         node->resetGeometry();
     }
 
-    inline bool updateMetrics( const QRectF& rect,
-        const QskBoxShapeMetrics& shape, const QskBoxBorderMetrics& borderMetrics )
+    inline bool updateMetrics( const QRectF& rect, const QskBoxShapeMetrics& shape,
+        const QskBoxBorderMetrics& borderMetrics, qreal devicePixelRatio )
     {
-        QskHashValue hash = 13000;
+        QskHashValue hash = QskTessellation::hash( devicePixelRatio, 13000 );
 
         hash = qHashBits( &rect, sizeof( rect ), hash );
         hash = shape.hash( hash );
@@ -77,6 +81,7 @@ QskBoxRectangleNode::QskBoxRectangleNode()
 
 QskBoxRectangleNode::~QskBoxRectangleNode()
 {
+    QskGeometryJobs::cancel( this );
 }
 
 void QskBoxRectangleNode::updateFilling( const QQuickWindow* window,
@@ -110,7 +115,10 @@ void QskBoxRectangleNode::updateFilling( const QQuickWindow* window,
     const bool coloredGeometry = hasHint( PreferColoredGeometry )
         && QskBoxRenderer::isGradientSupported( fillGradient );
 
-    bool dirtyGeometry = d->updateMetrics( rect, shape, borderMetrics );
+    const auto devicePixelRatio = QskTessellation::devicePixelRatio( window );
+
+    bool dirtyGeometry = d->updateMetrics(
+        rect, shape, borderMetrics, devicePixelRatio );
     bool dirtyMaterial = d->updateColors( QskBoxBorderColors(), fillGradient );
 
     if ( coloredGeometry != isGeometryColored() )
@@ -118,14 +126,20 @@ void QskBoxRectangleNode::updateFilling( const QQuickWindow* window,
 
     if ( dirtyGeometry || dirtyMaterial )
     {
-        QskBoxRenderer renderer( window );
+        auto geometry = this->geometry();
 
         if ( coloredGeometry )
         {
             setColoring( QskFillNode::Polychrome );
 
-            renderer.setColoredFillLines( rect, shape,
-                borderMetrics, fillGradient, *geometry() );
+            QskGeometryJobs::submit( window, this,
+                [=]()
+                {
+                    QskBoxRenderer renderer( devicePixelRatio );
+                    renderer.setColoredFillLines( rect, shape,
+                        borderMetrics, fillGradient, *geometry );
+                }
+            );
 
             markDirty( QSGNode::DirtyGeometry );
         }
@@ -135,7 +149,14 @@ void QskBoxRectangleNode::updateFilling( const QQuickWindow* window,
 
             if ( dirtyGeometry )
             {
-                renderer.setFillLines( rect, shape, borderMetrics, *geometry() );
+                QskGeometryJobs::submit( window, this,
+                    [=]()
+                    {
+                        QskBoxRenderer renderer( devicePixelRatio );
+                        renderer.setFillLines( rect, shape, borderMetrics, *geometry );
+                    }
+                );
+
                 markDirty( QSGNode::DirtyGeometry );
             }
         }
@@ -159,7 +180,10 @@ void QskBoxRectangleNode::updateBorder( const QQuickWindow* window,
     const bool coloredGeometry = hasHint( PreferColoredGeometry )
         || !borderColors.isMonochrome();
 
-    bool dirtyGeometry = d->updateMetrics( rect, shape, borderMetrics );
+    const auto devicePixelRatio = QskTessellation::devicePixelRatio( window );
+
+    bool dirtyGeometry = d->updateMetrics(
+        rect, shape, borderMetrics, devicePixelRatio );
     bool dirtyMaterial = d->updateColors( borderColors, QskGradient() );
 
     if ( coloredGeometry != isGeometryColored() )
@@ -167,14 +191,20 @@ void QskBoxRectangleNode::updateBorder( const QQuickWindow* window,
 
     if ( dirtyGeometry || dirtyMaterial )
     {
-        QskBoxRenderer renderer( window );
+        auto geometry = this->geometry();
 
         if ( coloredGeometry )
         {
             setColoring( QskFillNode::Polychrome );
 
-            renderer.setColoredBorderLines( rect, shape,
-                borderMetrics, borderColors, *geometry() );
+            QskGeometryJobs::submit( window, this,
+                [=]()
+                {
+                    QskBoxRenderer renderer( devicePixelRatio );
+                    renderer.setColoredBorderLines( rect, shape,
+                        borderMetrics, borderColors, *geometry );
+                }
+            );
 
             markDirty( QSGNode::DirtyGeometry );
         }
@@ -184,8 +214,13 @@ void QskBoxRectangleNode::updateBorder( const QQuickWindow* window,
 
             if ( dirtyGeometry )
             {
-                renderer.setBorderLines( rect, shape,
-                    borderMetrics, *geometry() );
+                QskGeometryJobs::submit( window, this,
+                    [=]()
+                    {
+                        QskBoxRenderer renderer( devicePixelRatio );
+                        renderer.setBorderLines( rect, shape, borderMetrics, *geometry );
+                    }
+                );
 
                 markDirty( QSGNode::DirtyGeometry );
             }
@@ -211,8 +246,10 @@ void QskBoxRectangleNode::updateBox( const QQuickWindow* window, const QRectF& r
     if ( hasFill && hasBorder )
     {
         const auto shape = shapeMetrics.toAbsolute( rect.size() );
+        const auto devicePixelRatio = QskTessellation::devicePixelRatio( window );
 
-        const bool isDirty = d->updateMetrics( rect, shape, borderMetrics )
+        const bool isDirty =
+            d->updateMetrics( rect, shape, borderMetrics, devicePixelRatio )
             || d->updateColors( borderColors, gradient ) || !isGeometryColored();
 
         if ( isDirty )
@@ -231,9 +268,16 @@ void QskBoxRectangleNode::updateBox( const QQuickWindow* window, const QRectF& r
                 fillGradient.setDirection( QskGradient::Linear );
             }
 
-            QskBoxRenderer renderer( window );
-            renderer.setColoredBorderAndFillLines( rect, shape, borderMetrics,
-                borderColors, fillGradient, *geometry() );
+            auto geometry = this->geometry();
+
+            QskGeometryJobs::submit( window, this,
+                [=]()
+                {
+                    QskBoxRenderer renderer( devicePixelRatio );
+                    renderer.setColoredBorderAndFillLines( rect, shape,
+                        borderMetrics, borderColors, fillGradient, *geometry );
+                }
+            );
 
             markDirty( QSGNode::DirtyGeometry );
         }
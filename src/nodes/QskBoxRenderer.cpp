@@ -10,6 +10,7 @@
 #include "QskBoxMetrics.h"
 #include "QskBoxBasicStroker.h"
 #include "QskBoxGradientStroker.h"
+#include "QskTessellation.h"
 
 #include "QskGradient.h"
 #include "QskGradientDirection.h"
@@ -71,7 +72,12 @@ static inline bool qskMaybeSpreading( const QskGradient& gradient )
 }
 
 QskBoxRenderer::QskBoxRenderer( const QQuickWindow* window )
-    : m_window( window )
+    : m_devicePixelRatio( QskTessellation::devicePixelRatio( window ) )
+{
+}
+
+QskBoxRenderer::QskBoxRenderer( qreal devicePixelRatio )
+    : m_devicePixelRatio( devicePixelRatio )
 {
 }
 
@@ -125,7 +131,7 @@ void QskBoxRenderer::setBorderLines(
     geometry.setDrawingMode( QSGGeometry::DrawTriangleStrip );
     geometry.markVertexDataDirty();
 
-    const QskBoxMetrics metrics( rect, shape, border );
+    const QskBoxMetrics metrics( rect, shape, border, m_devicePixelRatio );
     const QskBoxBasicStroker stroker( metrics );
 
     const auto lines = qskAllocateLines( geometry, stroker.borderCount() );
@@ -146,7 +152,7 @@ void QskBoxRenderer::setFillLines(
     geometry.setDrawingMode( QSGGeometry::DrawTriangleStrip );
     geometry.markVertexDataDirty();
 
-    const QskBoxMetrics metrics( rect, shape, border );
+    const QskBoxMetrics metrics( rect, shape, border, m_devicePixelRatio );
     QskBoxBasicStroker stroker( metrics );
 
     if ( auto lines = qskAllocateLines( geometry, stroker.fillCount() ) )
@@ -168,7 +174,7 @@ void QskBoxRenderer::setColoredBorderLines( const QRectF& rect,
     geometry.setDrawingMode( QSGGeometry::DrawTriangleStrip );
     geometry.markVertexDataDirty();
 
-    const QskBoxMetrics metrics( rect, shape, border );
+    const QskBoxMetrics metrics( rect, shape, border, m_devicePixelRatio );
     const QskBoxBasicStroker stroker( metrics, borderColors );
 
     if ( auto lines = qskAllocateColoredLines( geometry, stroker.borderCount() ) )
@@ -183,7 +189,7 @@ void QskBoxRenderer::setColoredBorderAndFillLines( const QRectF& rect,
     geometry.setDrawingMode( QSGGeometry::DrawTriangleStrip );
     geometry.markVertexDataDirty();
 
-    const QskBoxMetrics metrics( rect, shape, border );
+    const QskBoxMetrics metrics( rect, shape, border, m_devicePixelRatio );
     const auto effectiveGradient = qskEffectiveGradient( metrics.innerRect, gradient );
 
     if ( metrics.innerRect.isEmpty() ||
@@ -21,6 +21,8 @@ class QSK_EXPORT QskBoxRenderer
 {
   public:
     QskBoxRenderer( const QQuickWindow* );
+    explicit QskBoxRenderer( qreal devicePixelRatio );
+
     ~QskBoxRenderer();
 
     /*
@@ -63,8 +65,8 @@ class QSK_EXPORT QskBoxRenderer
     static QskGradient effectiveGradient( const QskGradient& );
 
   private:
-    // for adjustments to the target ( f.e devicePixelRatio )
-    const QQuickWindow* m_window;
+    // for adjustments to the target
+    const qreal m_devicePixelRatio;
 };
 
 #endif
@@ -8,14 +8,15 @@
 #include "QskBoxRenderer.h"
 #include "QskBoxShapeMetrics.h"
 #include "QskFunctions.h"
+#include "QskTessellation.h"
 #include "QskVertex.h"
 
 #include <qquickwindow.h>
 
-static inline QskHashValue qskMetricsHash(
-    const QskBoxShapeMetrics& shape, const QskBoxBorderMetrics& border )
+static inline QskHashValue qskMetricsHash( const QskBoxShapeMetrics& shape,
+    const QskBoxBorderMetrics& border, qreal devicePixelRatio )
 {
-    QskHashValue hash = 13000;
+    QskHashValue hash = QskTessellation::hash( devicePixelRatio, 13000 );
 
     hash = shape.hash( hash );
     return border.hash( hash );
@@ -118,7 +119,8 @@ void QskClipNode::setBox( const QQuickWindow* window, const QRectF& rect,
         return;
     }
 
-    const auto hash = qskMetricsHash( shape, border );
+    const auto hash = qskMetricsHash( shape, border,
+        QskTessellation::devicePixelRatio( window ) );
     if ( hash == m_hash && rect == boundingRectangle() )
         return;
 
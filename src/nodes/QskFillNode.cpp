@@ -7,6 +7,7 @@
 #include "QskGradientMaterial.h"
 #include "QskFillNodePrivate.h"
 #include "QskSGNode.h"
+#include "QskGeometryJobs.h"
 
 #include <qsgflatcolormaterial.h>
 #include <qsgvertexcolormaterial.h>
@@ -60,6 +61,7 @@ QskFillNode::~QskFillNode()
 
 void QskFillNode::resetGeometry()
 {
+    QskGeometryJobs::cancel( this );
     QskSGNode::resetGeometry( this );
 }
 
@@ -111,6 +113,9 @@ void QskFillNode::setColoring( Coloring coloring )
 
         if ( !isGeometryColored() )
         {
+            // a pending job would write the wrong vertex layout
+            QskGeometryJobs::cancel( this );
+
             const QSGGeometry g( QSGGeometry::defaultAttributes_ColoredPoint2D(), 0 );
             memcpy( ( void* ) &d->geometry, ( void* ) &g, sizeof( QSGGeometry ) );
         }
@@ -121,6 +126,8 @@ void QskFillNode::setColoring( Coloring coloring )
 
         if ( isGeometryColored() )
         {
+            QskGeometryJobs::cancel( this );
+
             const QSGGeometry g( QSGGeometry::defaultAttributes_Point2D(), 0 );
             memcpy( ( void* ) &d->geometry, ( void* ) &g, sizeof( QSGGeometry ) );
         }
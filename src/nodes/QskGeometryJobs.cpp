@@ -0,0 +1,241 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) The authors
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#include "QskGeometryJobs.h"
+
+#include <qquickwindow.h>
+#include <qthreadpool.h>
+#include <qsemaphore.h>
+#include <qmutex.h>
+#include <qset.h>
+#include <qhash.h>
+#include <qglobalstatic.h>
+
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+static std::atomic< int > qskParallelismThreshold { 64 };
+
+namespace
+{
+    class Entry
+    {
+      public:
+        const QSGNode* node;
+        QskGeometryJobs::Job job;
+    };
+
+    class Runnable final : public QRunnable
+    {
+      public:
+        Runnable( const Entry* begin, const Entry* end, QSemaphore* semaphore )
+            : m_begin( begin )
+            , m_end( end )
+            , m_semaphore( semaphore )
+        {
+        }
+
+        void run() override
+        {
+            for ( auto entry = m_begin; entry != m_end; ++entry )
+                entry->job();
+
+            m_semaphore->release();
+        }
+
+      private:
+        const Entry* m_begin;
+        const Entry* m_end;
+        QSemaphore* m_semaphore;
+    };
+
+    /*
+        The scene graph of a window is synchronized on its render thread
+        and the same thread emits QQuickWindow::afterSynchronizing.
+        So all jobs, that have been submitted from the render thread
+        belong to the window being synchronized.
+     */
+    class Queue
+    {
+      public:
+        void submit( const QSGNode* node, const QskGeometryJobs::Job& job )
+        {
+            const auto it = m_indexes.constFind( node );
+            if ( it != m_indexes.constEnd() )
+            {
+                m_entries[ it.value() ].job = job;
+            }
+            else
+            {
+                m_indexes.insert( node, static_cast< int >( m_entries.size() ) );
+                m_entries.push_back( { node, job } );
+            }
+        }
+
+        void cancel( const QSGNode* node )
+        {
+            const auto it = m_indexes.constFind( node );
+            if ( it != m_indexes.constEnd() )
+            {
+                // keeping the indexes valid
+                m_entries[ it.value() ].job = nullptr;
+                m_entries[ it.value() ].node = nullptr;
+
+                m_indexes.erase( it );
+            }
+        }
+
+        void flush()
+        {
+            if ( m_entries.empty() )
+                return;
+
+            auto entries = std::move( m_entries );
+
+            m_entries.clear();
+            m_indexes.clear();
+
+            // canceled jobs
+            entries.erase( std::remove_if( entries.begin(), entries.end(),
+                []( const Entry& entry ) { return entry.job == nullptr; } ), entries.end() );
+
+            run( entries );
+        }
+
+      private:
+        static void run( const std::vector< Entry >& entries )
+        {
+            const int count = static_cast< int >( entries.size() );
+
+            /*
+                The global pool is shared with the application and
+                other parts of the library. Blocking the render thread
+                by jobs, that are waiting for a busy pool, has to be avoided:
+                we only use idle threads and process all chunks, that
+                could not be started, ourselves.
+             */
+            auto pool = QThreadPool::globalInstance();
+
+            const int idleCount = pool->maxThreadCount() - pool->activeThreadCount();
+            const int threadCount = qMin( idleCount + 1, count );
+
+            if ( count < qskParallelismThreshold || threadCount <= 1 )
+            {
+                for ( const auto& entry : entries )
+                    entry.job();
+
+                return;
+            }
+
+            // the first chunk is always processed by the render thread
+
+            const auto chunkSize = ( count + threadCount - 1 ) / threadCount;
+            const auto begin = entries.data();
+
+            QSemaphore semaphore;
+
+            int chunkCount = 0;
+            for ( int i = chunkSize; i < count; i += chunkSize )
+            {
+                const auto end = begin + qMin( i + chunkSize, count );
+
+                auto runnable = new Runnable( begin + i, end, &semaphore );
+                if ( pool->tryStart( runnable ) )
+                {
+                    chunkCount++;
+                }
+                else
+                {
+                    delete runnable;
+
+                    for ( auto entry = begin + i; entry != end; ++entry )
+                        entry->job();
+                }
+            }
+
+            for ( auto entry = begin; entry != begin + chunkSize; ++entry )
+                entry->job();
+
+            semaphore.acquire( chunkCount );
+        }
+
+        std::vector< Entry > m_entries;
+        QHash< const QSGNode*, int > m_indexes;
+    };
+
+    class WindowRegistry
+    {
+      public:
+        void ensureConnection( const QQuickWindow* window )
+        {
+            QMutexLocker locker( &m_mutex );
+
+            if ( m_windows.contains( window ) )
+                return;
+
+            m_windows.insert( window );
+
+            auto w = const_cast< QQuickWindow* >( window );
+
+            // afterSynchronizing is emitted from the render thread
+            QObject::connect( w, &QQuickWindow::afterSynchronizing,
+                w, &WindowRegistry::flush, Qt::DirectConnection );
+
+            QObject::connect( w, &QObject::destroyed,
+                w, [this, window]() { remove( window ); } );
+        }
+
+      private:
+        void remove( const QQuickWindow* window )
+        {
+            QMutexLocker locker( &m_mutex );
+            m_windows.remove( window );
+        }
+
+        static void flush();
+
+        QMutex m_mutex;
+        QSet< const QQuickWindow* > m_windows;
+    };
+}
+
+static thread_local Queue qskQueue;
+Q_GLOBAL_STATIC( WindowRegistry, qskWindowRegistry )
+
+void WindowRegistry::flush()
+{
+    qskQueue.flush();
+}
+
+void QskGeometryJobs::submit( const QQuickWindow* window,
+    const QSGNode* node, const Job& job )
+{
+    if ( window == nullptr || qskParallelismThreshold <= 0 )
+    {
+        qskQueue.cancel( node );
+        job();
+
+        return;
+    }
+
+    qskWindowRegistry->ensureConnection( window );
+    qskQueue.submit( node, job );
+}
+
+void QskGeometryJobs::cancel( const QSGNode* node )
+{
+    qskQueue.cancel( node );
+}
+
+void QskGeometryJobs::setParallelismThreshold( int threshold )
+{
+    qskParallelismThreshold = threshold;
+}
+
+int QskGeometryJobs::parallelismThreshold()
+{
+    return qskParallelismThreshold;
+}
@@ -0,0 +1,56 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) The authors
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#ifndef QSK_GEOMETRY_JOBS_H
+#define QSK_GEOMETRY_JOBS_H
+
+#include "QskGlobal.h"
+#include <functional>
+
+class QQuickWindow;
+class QSGNode;
+
+/*
+    Building geometries ( tessellating boxes, arcs ... ) is a pure function
+    of the metrics, that writes into the geometry of a node. When updating
+    many nodes at once - f.e after changing the skin - it is worth
+    to do this in parallel.
+
+    Instead of building its geometry a node might submit a job, that is
+    executed, when the scene graph of the window has been synchronized
+    ( QQuickWindow::afterSynchronizing ). The node has to do all other
+    modifications ( materials, dirty flags ) serially in advance and must
+    not touch the geometry until the job has been executed. When the geometry
+    is reset or replaced by one with a different attribute set the pending
+    job has to be canceled: QskFillNode does this in setColoring/resetGeometry.
+
+    The jobs are executed on worker threads and must not access the window
+    or any other object, that is not thread-safe: values like the device
+    pixel ratio have to be resolved before submitting.
+
+    When the number of pending jobs is below the parallelism threshold
+    they are executed serially. Only idle threads of the global thread pool
+    are used, the remaining jobs are executed by the render thread.
+    For a threshold <= 0 the jobs are executed immediately when being
+    submitted.
+ */
+namespace QskGeometryJobs
+{
+    using Job = std::function< void() >;
+
+    /*
+        A job replaces a pending job of the same node. Without a window
+        the job is executed immediately.
+     */
+    QSK_EXPORT void submit( const QQuickWindow*, const QSGNode*, const Job& );
+
+    // to be called, when the node is deleted or its geometry is reset
+    QSK_EXPORT void cancel( const QSGNode* );
+
+    QSK_EXPORT void setParallelismThreshold( int );
+    QSK_EXPORT int parallelismThreshold();
+}
+
+#endif
@@ -0,0 +1,215 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) The authors
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#include "QskGlyphNodes.h"
+#include "QskInternalMacros.h"
+
+#include <qglyphrun.h>
+#include <qquickwindow.h>
+#include <qsgnode.h>
+
+QSK_QT_PRIVATE_BEGIN
+#include <private/qquickitem_p.h>
+QSK_QT_PRIVATE_END
+
+#define GlyphFlag static_cast< QSGNode::Flag >( 0x800 )
+
+/*
+    The render type of a glyph node can't be changed, so we
+    remember it in 2 bits, that are not used by QskSGNode::nodeRole
+ */
+#define RenderTypeShift 4
+#define RenderTypeMask ( 0x3 << RenderTypeShift )
+
+static inline QskTextOptions::RenderType qskEffectiveRenderType(
+    QskTextOptions::RenderType renderType )
+{
+    if ( renderType == QskTextOptions::DefaultRendering )
+    {
+        switch( static_cast< int >( QQuickWindow::textRenderType() ) )
+        {
+            case QQuickWindow::NativeTextRendering:
+                return QskTextOptions::NativeRendering;
+
+#if QT_VERSION >= QT_VERSION_CHECK( 6, 7, 0 )
+            case QQuickWindow::CurveTextRendering:
+                return QskTextOptions::CurveRendering;
+#endif
+            default:
+                return QskTextOptions::DistanceFieldRendering;
+        }
+    }
+
+#if QT_VERSION < QT_VERSION_CHECK( 6, 7, 0 )
+    if ( renderType == QskTextOptions::CurveRendering )
+        return QskTextOptions::DistanceFieldRendering;
+#endif
+
+    return renderType;
+}
+
+static inline QskTextOptions::RenderType qskRenderType( const QSGNode* node )
+{
+    return static_cast< QskTextOptions::RenderType >(
+        ( node->flags() & RenderTypeMask ) >> RenderTypeShift );
+}
+
+static QSGGlyphNode* qskCreateGlyphNode(
+    QQuickItem* item, QskTextOptions::RenderType renderType )
+{
+    auto renderContext = QQuickItemPrivate::get( item )->sceneGraphRenderContext();
+    auto sgContext = renderContext->sceneGraphContext();
+
+    constexpr int renderQuality = -1; // QQuickText::DefaultRenderTypeQuality
+
+    QSGGlyphNode* glyphNode;
+
+#if QT_VERSION >= QT_VERSION_CHECK( 6, 7, 0 )
+    auto sgRenderType = QSGTextNode::QtRendering;
+
+    if ( renderType == QskTextOptions::NativeRendering )
+        sgRenderType = QSGTextNode::NativeRendering;
+    else if ( renderType == QskTextOptions::CurveRendering )
+        sgRenderType = QSGTextNode::CurveRendering;
+
+    glyphNode = sgContext->createGlyphNode(
+        renderContext, sgRenderType, renderQuality );
+#else
+    const bool preferNativeGlyphNode =
+        ( renderType == QskTextOptions::NativeRendering );
+
+#if QT_VERSION >= QT_VERSION_CHECK( 6, 0, 0 )
+    glyphNode = sgContext->createGlyphNode(
+        renderContext, preferNativeGlyphNode, renderQuality );
+#else
+    Q_UNUSED( renderQuality );
+    glyphNode = sgContext->createGlyphNode(
+        renderContext, preferNativeGlyphNode );
+#endif
+#endif
+
+#if QT_VERSION < QT_VERSION_CHECK( 6, 7, 0 )
+    glyphNode->setOwnerElement( item );
+#endif
+
+    const auto renderTypeFlags = static_cast< QSGNode::Flag >(
+        renderType << RenderTypeShift );
+
+    glyphNode->setFlags( QSGNode::OwnedByParent | GlyphFlag | renderTypeFlags );
+
+    return glyphNode;
+}
+
+bool QskGlyphNodes::isGlyphNode( const QSGNode* node )
+{
+    return node && ( node->flags() & GlyphFlag );
+}
+
+void QskGlyphNodes::updateNodes( const QQuickItem* item, QSGNode* parentNode,
+    const QList< QGlyphRun >& glyphRuns, const QPointF& position,
+    const QColor& textColor, const QVector< QColor >& runColors,
+    Qsk::TextStyle textStyle, const QColor& styleColor,
+    QskTextOptions::RenderType renderType )
+{
+    // Clear out foreign nodes (e.g. from QskRichTextRenderer)
+    QSGNode* node = parentNode->firstChild();
+    while ( node )
+    {
+        auto sibling = node->nextSibling();
+        if ( !( node->flags() & GlyphFlag ) )
+        {
+            parentNode->removeChildNode( node );
+            delete node;
+        }
+        node = sibling;
+    }
+
+    auto glyphNode = parentNode->firstChild();
+
+    for ( int i = 0; i < glyphRuns.count(); i++ )
+    {
+        auto color = textColor;
+        if ( i < runColors.count() && runColors[i].isValid() )
+            color = runColors[i];
+
+        auto node = updateNode( item, glyphNode, glyphRuns[i],
+            position, color, textStyle, styleColor, renderType );
+
+        if ( node != glyphNode )
+        {
+            if ( glyphNode )
+            {
+                // the render type has changed
+                parentNode->insertChildNodeAfter( node, glyphNode );
+                parentNode->removeChildNode( glyphNode );
+                delete glyphNode;
+            }
+            else
+            {
+                parentNode->appendChildNode( node );
+            }
+        }
+
+        glyphNode = node->nextSibling();
+    }
+
+    // Remove leftover glyphs
+    while ( glyphNode )
+    {
+        auto sibling = glyphNode->nextSibling();
+        if ( glyphNode->flags() & GlyphFlag )
+        {
+            parentNode->removeChildNode( glyphNode );
+            delete glyphNode;
+        }
+        glyphNode = sibling;
+    }
+}
+
+QSGNode* QskGlyphNodes::updateNode( const QQuickItem* item, QSGNode* node,
+    const QGlyphRun& glyphRun, const QPointF& position, const QColor& textColor,
+    Qsk::TextStyle style, const QColor& styleColor,
+    QskTextOptions::RenderType renderType )
+{
+    renderType = qskEffectiveRenderType( renderType );
+
+    auto glyphNode = static_cast< QSGGlyphNode* >( node );
+    if ( glyphNode && qskRenderType( glyphNode ) != renderType )
+    {
+        /*
+            The type of a glyph node can't be changed: the caller
+            has to replace the node by the one being returned
+         */
+        glyphNode = nullptr;
+    }
+
+    if ( glyphNode == nullptr )
+        glyphNode = qskCreateGlyphNode( const_cast< QQuickItem* >( item ), renderType );
+
+    glyphNode->setStyle( static_cast< QQuickText::TextStyle >( style ) );
+    glyphNode->setColor( textColor );
+    glyphNode->setStyleColor( styleColor );
+    glyphNode->setGlyphs( position, glyphRun );
+    glyphNode->update();
+
+    return glyphNode;
+}
+
+void QskGlyphNodes::updateColors( QSGNode* parentNode,
+    const QColor& textColor, Qsk::TextStyle style, const QColor& styleColor )
+{
+    auto glyphNode = static_cast< QSGGlyphNode* >( parentNode->firstChild() );
+    while ( glyphNode )
+    {
+        if ( glyphNode->flags() & GlyphFlag )
+        {
+            glyphNode->setColor( textColor );
+            glyphNode->setStyle( static_cast< QQuickText::TextStyle >( style ) );
+            glyphNode->setStyleColor( styleColor );
+            glyphNode->update();
+        }
+        glyphNode = static_cast< QSGGlyphNode* >( glyphNode->nextSibling() );
+    }
+}
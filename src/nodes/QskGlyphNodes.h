@@ -0,0 +1,52 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) The authors
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#ifndef QSK_GLYPH_NODES_H
+#define QSK_GLYPH_NODES_H
+
+#include "QskNamespace.h"
+#include "QskTextOptions.h"
+
+#include <qlist.h>
+#include <qvector.h>
+#include <qcolor.h>
+
+class QGlyphRun;
+class QPointF;
+class QQuickItem;
+class QSGNode;
+
+namespace QskGlyphNodes
+{
+    /*
+        Creates/updates a QSGGlyphNode for each glyph run as children
+        of parentNode. Any other children are removed.
+
+        runColors are the colors of the glyph runs. Runs without a valid
+        color ( or an empty list ) are rendered in textColor.
+     */
+    void updateNodes( const QQuickItem*, QSGNode* parentNode,
+        const QList< QGlyphRun >&, const QPointF& position,
+        const QColor& textColor, const QVector< QColor >& runColors,
+        Qsk::TextStyle, const QColor& styleColor,
+        QskTextOptions::RenderType = QskTextOptions::DefaultRendering );
+
+    /*
+        Creates a new glyph node, when node is a nullptr or has been
+        created for a different render type. In this case the caller
+        is responsible for replacing node by the returned one.
+     */
+    QSGNode* updateNode( const QQuickItem*, QSGNode* node,
+        const QGlyphRun&, const QPointF& position, const QColor& textColor,
+        Qsk::TextStyle, const QColor& styleColor,
+        QskTextOptions::RenderType = QskTextOptions::DefaultRendering );
+
+    void updateColors( QSGNode* parentNode, const QColor& textColor,
+        Qsk::TextStyle, const QColor& styleColor );
+
+    bool isGlyphNode( const QSGNode* );
+}
+
+#endif
@@ -0,0 +1,302 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) The authors
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#include "QskInstancedBoxNode.h"
+#include "QskBoxBasicStroker.h"
+#include "QskBoxBorderColors.h"
+#include "QskBoxHints.h"
+#include "QskBoxMetrics.h"
+#include "QskGradient.h"
+#include "QskVertex.h"
+#include "QskTessellation.h"
+#include "QskFillNodePrivate.h"
+
+#include <vector>
+
+namespace
+{
+    /*
+        The tessellated contour of a box at the origin, that can be
+        translated and colored for each instance of the same size/shape.
+     */
+    class Template
+    {
+      public:
+        Template( const QSizeF& size, const QskBoxShapeMetrics& shape,
+                const QskBoxBorderMetrics& borderMetrics,
+                qreal devicePixelRatio, QskHashValue hash )
+            : hash( hash )
+            , size( size )
+            , shape( shape )
+            , borderMetrics( borderMetrics )
+        {
+            const QskBoxMetrics metrics( QRectF( QPointF(), size ),
+                shape.toAbsolute( size ), borderMetrics, devicePixelRatio );
+
+            const QskBoxBasicStroker stroker( metrics );
+
+            fillLines.resize( stroker.fillCount() );
+            if ( !fillLines.isEmpty() )
+                stroker.setFillLines( fillLines.data() );
+
+            borderLines.resize( stroker.borderCount() );
+            if ( !borderLines.isEmpty() )
+                stroker.setBorderLines( borderLines.data() );
+        }
+
+        inline bool matches( QskHashValue hash,
+            const QskInstancedBoxNode::Instance& instance ) const
+        {
+            // the hash is only a shortcut, collisions have to be detected
+            return ( hash == this->hash )
+                && ( instance.rect.size() == size )
+                && ( instance.shape == shape )
+                && ( instance.borderMetrics == borderMetrics );
+        }
+
+        QskHashValue hash;
+
+        QSizeF size;
+        QskBoxShapeMetrics shape;
+        QskBoxBorderMetrics borderMetrics;
+
+        QVector< QskVertex::Line > fillLines;
+        QVector< QskVertex::Line > borderLines;
+    };
+
+    inline QskHashValue qskTemplateHash( const QskInstancedBoxNode::Instance& instance )
+    {
+        const auto size = instance.rect.size();
+
+        auto hash = qHashBits( &size, sizeof( size ), 13000 );
+        hash = instance.shape.hash( hash );
+        hash = instance.borderMetrics.hash( hash );
+
+        return hash;
+    }
+
+    inline bool qskIsVisible( const QColor& color )
+    {
+        return color.isValid() && color.alpha() > 0;
+    }
+
+    class Writer
+    {
+      public:
+        inline Writer( QskVertex::ColoredLine* lines )
+            : m_lines( lines )
+        {
+        }
+
+        inline void appendLines( const QVector< QskVertex::Line >& lines,
+            const QPointF& offset, QskVertex::Color color )
+        {
+            if ( lines.isEmpty() )
+                return;
+
+            if ( m_count > 0 )
+            {
+                /*
+                    A degenerated line connecting the previous triangle strip
+                    with the following one. See QskBoxRenderer
+                 */
+                const auto& l1 = m_lines[ m_count - 1 ];
+                const auto& l2 = lines.first();
+
+                m_lines[ m_count++ ].setLine( l1.x2(), l1.y2(),
+                    l2.x1() + offset.x(), l2.y1() + offset.y(), color );
+            }
+
+            const float dx = offset.x();
+            const float dy = offset.y();
+
+            for ( const auto& l : lines )
+            {
+                m_lines[ m_count++ ].setLine(
+                    l.x1() + dx, l.y1() + dy, l.x2() + dx, l.y2() + dy, color );
+            }
+        }
+
+        inline int count() const { return m_count; }
+
+      private:
+        QskVertex::ColoredLine* m_lines;
+        int m_count = 0;
+    };
+}
+
+QskInstancedBoxNode::Instance::Instance(
+        const QRectF& rect, const QskBoxHints& hints )
+    : rect( rect )
+    , shape( hints.shape )
+    , borderMetrics( hints.borderMetrics )
+{
+    if ( !hints.borderMetrics.isNull() && hints.borderColors.isVisible() )
+        borderColor = hints.borderColors.left().startColor();
+
+    if ( hints.gradient.isVisible() )
+        fillColor = hints.gradient.startColor();
+}
+
+class QskInstancedBoxNodePrivate final : public QskFillNodePrivate
+{
+  public:
+    const Template& effectiveTemplate(
+        const QskInstancedBoxNode::Instance& instance )
+    {
+        const auto hash = qskTemplateHash( instance );
+
+        for ( const auto& t : std::as_const( templates ) )
+        {
+            if ( t.matches( hash, instance ) )
+                return t;
+        }
+
+        templates.emplace_back( instance.rect.size(),
+            instance.shape, instance.borderMetrics, devicePixelRatio, hash );
+
+        return templates.back();
+    }
+
+    // usually all instances share the same template
+    std::vector< Template > templates;
+
+    qreal devicePixelRatio = 1.0;
+
+    QskHashValue tessellationHash = 0;
+    QskHashValue hash = 0;
+};
+
+QskInstancedBoxNode::QskInstancedBoxNode()
+    : QskFillNode( *new QskInstancedBoxNodePrivate )
+{
+}
+
+QskInstancedBoxNode::~QskInstancedBoxNode()
+{
+}
+
+void QskInstancedBoxNode::updateNode(
+    const QQuickWindow* window, const QVector< Instance >& instances )
+{
+    Q_D( QskInstancedBoxNode );
+
+    const auto devicePixelRatio = QskTessellation::devicePixelRatio( window );
+    const auto tessellationHash = QskTessellation::hash( devicePixelRatio );
+
+    QskHashValue hash = tessellationHash;
+
+    for ( const auto& instance : instances )
+    {
+        hash = qHashBits( &instance.rect, sizeof( instance.rect ), hash );
+        hash = instance.shape.hash( hash );
+        hash = instance.borderMetrics.hash( hash );
+        hash = qHash( instance.borderColor.rgba(), hash );
+        hash = qHash( instance.fillColor.rgba(), hash );
+    }
+
+    if ( hash == d->hash )
+        return;
+
+    d->hash = hash;
+
+    if ( tessellationHash != d->tessellationHash )
+    {
+        d->templates.clear();
+
+        d->devicePixelRatio = devicePixelRatio;
+        d->tessellationHash = tessellationHash;
+    }
+
+    /*
+        Templates of a previous update are dropped, as we don't
+        want to accumulate them, when the size of the boxes is animated
+     */
+    decltype( d->templates ) oldTemplates;
+    oldTemplates.swap( d->templates );
+
+    for ( const auto& t : std::as_const( oldTemplates ) )
+    {
+        for ( const auto& instance : instances )
+        {
+            if ( t.matches( qskTemplateHash( instance ), instance ) )
+            {
+                d->templates.push_back( t );
+                break;
+            }
+        }
+    }
+
+    setColoring( QskFillNode::Polychrome );
+
+    int lineCount = 0;
+
+    for ( const auto& instance : instances )
+    {
+        if ( instance.rect.isEmpty() )
+            continue;
+
+        const auto& t = d->effectiveTemplate( instance );
+
+        if ( qskIsVisible( instance.fillColor ) && !t.fillLines.isEmpty() )
+            lineCount += t.fillLines.count() + 1;
+
+        if ( qskIsVisible( instance.borderColor ) && !t.borderLines.isEmpty() )
+            lineCount += t.borderLines.count() + 1;
+    }
+
+    if ( lineCount == 0 )
+    {
+        resetGeometry();
+        return;
+    }
+
+    auto& geometry = *this->geometry();
+
+    geometry.setDrawingMode( QSGGeometry::DrawTriangleStrip );
+
+    // the connecting line of the first strip is not needed
+    auto lines = QskVertex::allocateLines< QskVertex::ColoredLine >(
+        geometry, lineCount - 1 );
+
+    Writer writer( lines );
+
+    for ( const auto& instance : instances )
+    {
+        if ( instance.rect.isEmpty() )
+            continue;
+
+        const auto& t = d->effectiveTemplate( instance );
+        const auto pos = instance.rect.topLeft();
+
+        if ( qskIsVisible( instance.fillColor ) )
+            writer.appendLines( t.fillLines, pos, instance.fillColor );
+
+        if ( qskIsVisible( instance.borderColor ) )
+            writer.appendLines( t.borderLines, pos, instance.borderColor );
+    }
+
+    Q_ASSERT( writer.count() == lineCount - 1 );
+
+    geometry.markVertexDataDirty();
+    markDirty( QSGNode::DirtyGeometry );
+}
+
+bool QskInstancedBoxNode::isInstantiable( const QskBoxHints& hints )
+{
+    if ( !hints.shadowMetrics.isNull() && hints.shadowColor.isValid()
+        && hints.shadowColor.alpha() > 0 )
+    {
+        return false;
+    }
+
+    if ( hints.gradient.isVisible() && !hints.gradient.isMonochrome() )
+        return false;
+
+    if ( !hints.borderMetrics.isNull() && hints.borderColors.isVisible() )
+        return hints.borderColors.isMonochrome();
+
+    return true;
+}
@@ -0,0 +1,69 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) The authors
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#ifndef QSK_INSTANCED_BOX_NODE_H
+#define QSK_INSTANCED_BOX_NODE_H
+
+#include "QskGlobal.h"
+#include "QskFillNode.h"
+#include "QskBoxShapeMetrics.h"
+#include "QskBoxBorderMetrics.h"
+
+#include <qrect.h>
+#include <qvector.h>
+
+class QskBoxHints;
+class QskInstancedBoxNodePrivate;
+
+class QQuickWindow;
+
+/*
+    A node for many boxes, that differ in position, size and color only:
+    f.e the cells of a list view or the segments of a segmented bar.
+
+    The contour of a box is tessellated once for each combination of size
+    and shape and then copied into one geometry with the position and colors
+    of each instance. So N boxes end up in one geometry node and are rendered
+    with one draw call.
+
+    The scene graph does not offer instanced drawing for QSGGeometryNodes,
+    what would allow to move the copying to the GPU.
+ */
+class QSK_EXPORT QskInstancedBoxNode : public QskFillNode
+{
+    using Inherited = QskFillNode;
+
+  public:
+    class Instance
+    {
+      public:
+        Instance() = default;
+        Instance( const QRectF&, const QskBoxHints& );
+
+        QRectF rect;
+
+        QskBoxShapeMetrics shape;
+        QskBoxBorderMetrics borderMetrics;
+
+        QColor borderColor;
+        QColor fillColor;
+    };
+
+    QskInstancedBoxNode();
+    ~QskInstancedBoxNode() override;
+
+    void updateNode( const QQuickWindow*, const QVector< Instance >& );
+
+    /*
+        Shadows and boxes with gradients or multicolored borders
+        can't be rendered as instance
+     */
+    static bool isInstantiable( const QskBoxHints& );
+
+  private:
+    Q_DECLARE_PRIVATE( QskInstancedBoxNode )
+};
+
+#endif
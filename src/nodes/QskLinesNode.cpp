@@ -80,6 +80,47 @@ static QSGGeometry::Point2D* qskAddDashes( const QTransform& transform,
     return points;
 }
 
+static QSGGeometry::TexturedPoint2D* qskAddStippledLines( const QTransform& transform,
+    int count, const QLineF* lines, QSGGeometry::TexturedPoint2D* points )
+{
+    const bool doTransform = !transform.isIdentity();
+
+    for ( int i = 0; i < count; i++ )
+    {
+        auto p1 = lines[i].p1();
+        auto p2 = lines[i].p2();
+
+        if ( doTransform )
+        {
+            p1 = transform.map( p1 );
+            p2 = transform.map( p2 );
+        }
+
+        // the position along the line is used in the fragment shader
+        const auto length = QLineF( p1, p2 ).length();
+
+        points++->set( p1.x(), p1.y(), 0.0, 0.0 );
+        points++->set( p2.x(), p2.y(), length, 0.0 );
+    }
+
+    return points;
+}
+
+static QVector< QLineF > qskGridLines( const QRectF& rect,
+    const QVector< qreal >& xValues, const QVector< qreal >& yValues )
+{
+    QVector< QLineF > lines;
+    lines.reserve( xValues.count() + yValues.count() );
+
+    for ( const auto x : xValues )
+        lines += QLineF( x, rect.top(), x, rect.bottom() );
+
+    for ( const auto y : yValues )
+        lines += QLineF( rect.left(), y, rect.right(), y );
+
+    return lines;
+}
+
 static QSGGeometry::Point2D* qskAddLines( const QTransform& transform,
     int count, const QLineF* lines, QSGGeometry::Point2D* points )
 {
@@ -170,11 +211,14 @@ void QskLinesNode::updateLines( const QColor& color,
         return;
     }
 
+    const bool isStippled = setStippleMetrics( stippleMetrics );
+
     QskHashValue hash = 9784;
 
-    hash = stippleMetrics.hash( hash );
+    // dashes done in the shader do not affect the geometry
+    hash = isStippled ? qHash( isStippled, hash ) : stippleMetrics.hash( hash );
     hash = qHash( transform, hash );
-    hash = qHashBits( lines, count * sizeof( QLineF ) );
+    hash = qHashBits( lines, count * sizeof( QLineF ), hash );
 
     if ( hash != m_hash )
     {
@@ -201,9 +245,11 @@ void QskLinesNode::updateGrid( const QColor& color,
         return;
     }
 
+    const bool isStippled = setStippleMetrics( stippleMetrics );
+
     QskHashValue hash = 9784;
 
-    hash = stippleMetrics.hash( hash );
+    hash = isStippled ? qHash( isStippled, hash ) : stippleMetrics.hash( hash );
     hash = qHash( transform, hash );
     hash = qHashBits( &rect, sizeof( QRectF ), hash );
     hash = qHash( xValues, hash );
@@ -228,6 +274,17 @@ void QskLinesNode::updateGeometry( const QskStippleMetrics& stippleMetrics,
 {
     auto& geom = *geometry();
 
+    if ( isStippled() )
+    {
+        geom.allocate( 2 * count );
+
+        auto points = geom.vertexDataAsTexturedPoint2D();
+        points = qskAddStippledLines( transform, count, lines, points );
+
+        Q_ASSERT( geom.vertexCount() == ( points - geom.vertexDataAsTexturedPoint2D() ) );
+        return;
+    }
+
     QSGGeometry::Point2D* points = nullptr;
 
     if ( stippleMetrics.isSolid() )
@@ -274,6 +331,18 @@ void QskLinesNode::updateGeometry(
     const QTransform& transform, const QRectF& rect,
     const QVector< qreal >& xValues, const QVector< qreal >& yValues )
 {
+    if ( isStippled() || ( transform.type() > QTransform::TxScale ) )
+    {
+        /*
+            Rotated grids can't be done with the optimized code below.
+            For dashes from the shader we need the line lengths anyway.
+         */
+        const auto lines = qskGridLines( rect, xValues, yValues );
+        updateGeometry( stippleMetrics, transform, lines.count(), lines.constData() );
+
+        return;
+    }
+
     auto& geom = *geometry();
 
     const auto y1 = mapY( transform, rect.top() );
@@ -415,6 +484,9 @@ void QskLinesNode::updatePolygon( const QColor& color, qreal lineWidth,
         return;
     }
 
+    setStippleMetrics( QskStippleMetrics() );
+    m_hash = 0;
+
     if ( true ) // for the moment we always update the geometry. TODO ...
     {
         geometry()->allocate( polygon.count() + 1 );
@@ -18,7 +18,10 @@ class QPolygonF;
 
 /*
     A node for stippled or solid lines.
-    For the moment limited to horizontal/vertical lines: TODO
+
+    Dash patterns with up to 8 entries are done in the fragment shader,
+    so that the geometry does not depend on the number of dashes.
+    Other patterns are split into dashes on the CPU.
  */
 class QSK_EXPORT QskLinesNode : public QskBasicLinesNode
 {
@@ -6,6 +6,8 @@
 #include "QskPlainTextRenderer.h"
 #include "QskTextColors.h"
 #include "QskTextOptions.h"
+#include "QskTextCache.h"
+#include "QskGlyphNodes.h"
 #include "QskInternalMacros.h"
 
 #include <qfontmetrics.h>
@@ -16,25 +18,6 @@ QSK_QT_PRIVATE_BEGIN
 #include <private/qquickitem_p.h>
 QSK_QT_PRIVATE_END
 
-#define GlyphFlag static_cast< QSGNode::Flag >( 0x800 )
-
-QSizeF QskPlainTextRenderer::textSize(
-    const QString& text, const QFont& font, const QskTextOptions& options )
-{
-    // result differs from QQuickText::implicitSizeHint ???
-    return textRect( text, font, options, QSizeF( 10e6, 10e6 ) ).size();
-}
-
-QRectF QskPlainTextRenderer::textRect(
-    const QString& text, const QFont& font, const QskTextOptions& options,
-    const QSizeF& size )
-{
-    const QFontMetricsF fm( font );
-    const QRectF r( 0, 0, size.width(), size.height() );
-
-    return fm.boundingRect( r, options.textFlags(), text );
-}
-
 static qreal qskLayoutText( QTextLayout* layout,
     qreal lineWidth, const QskTextOptions& options )
 {
@@ -95,136 +78,110 @@ static qreal qskLayoutText( QTextLayout* layout,
     return y;
 }
 
-static void qskRenderText(
-    QQuickItem* item, QSGNode* parentNode, const QTextLayout& layout, qreal baseLine,
-    const QColor& color, QQuickText::TextStyle style, const QColor& styleColor )
+static QskTextCache::Layout qskTextLayout( const QString& text,
+    const QFont& font, const QskTextOptions& options,
+    Qt::Alignment alignment, qreal width )
 {
-    auto renderContext = QQuickItemPrivate::get(item)->sceneGraphRenderContext();
-    auto sgContext = renderContext->sceneGraphContext();
-
-    // Clear out foreign nodes (e.g. from QskRichTextRenderer)
-    QSGNode* node = parentNode->firstChild();
-    while ( node )
-    {
-        auto sibling = node->nextSibling();
-        if ( !( node->flags() & GlyphFlag ) )
-        {
-            parentNode->removeChildNode( node );
-            delete node;
-        }
-        node = sibling;
-    }
-
-    auto glyphNode = static_cast< QSGGlyphNode* >( parentNode->firstChild() );
+    /*
+        The glyphs do not depend on the height of the rectangle and
+        the vertical alignment: the baseline is adjusted by qskBaseLine.
+     */
+    const QskTextCache::Key key( QskTextCache::Key::TextLayout,
+        text, font, options, QSizeF( width, 0.0 ),
+        alignment & Qt::AlignHorizontal_Mask );
 
-    const QPointF position( 0, baseLine );
+    QskTextCache::Layout textLayout;
 
-    for ( int i = 0; i < layout.lineCount(); ++i )
+    if ( !QskTextCache::findLayout( key, textLayout ) )
     {
-        const auto glyphRuns = layout.lineAt( i ).glyphRuns();
+        QString tmp = text;
 
-        for ( const auto& glyphRun : glyphRuns )
+#if 0
+        const int pos = tmp.indexOf( QLatin1Char( '\x9c' ) );
+        if ( pos != -1 )
         {
-            if ( glyphNode == nullptr )
-            {
-                const bool preferNativeGlyphNode = false; // QskTextOptions?
-                constexpr int renderQuality = -1; // QQuickText::DefaultRenderTypeQuality
-
-#if QT_VERSION >= QT_VERSION_CHECK( 6, 7, 0 )
-                const auto renderType = preferNativeGlyphNode
-                    ? QSGTextNode::QtRendering : QSGTextNode::NativeRendering;
-                glyphNode = sgContext->createGlyphNode(
-                    renderContext, renderType, renderQuality );
-#elif QT_VERSION >= QT_VERSION_CHECK( 6, 0, 0 )
-                glyphNode = sgContext->createGlyphNode(
-                    renderContext, preferNativeGlyphNode, renderQuality );
-#else
-                Q_UNUSED( renderQuality );
-                glyphNode = sgContext->createGlyphNode(
-                    renderContext, preferNativeGlyphNode );
-#endif
+            // ST: string termination
 
-#if QT_VERSION < QT_VERSION_CHECK( 6, 7, 0 )
-                glyphNode->setOwnerElement( item );
+            tmp = tmp.mid( 0, pos );
+            tmp.replace( QLatin1Char( '\n' ), QChar::LineSeparator );
+        }
+        else
 #endif
+        if ( tmp.contains( QLatin1Char( '\n' ) ) )
+        {
+            tmp.replace( QLatin1Char('\n'), QChar::LineSeparator );
+        }
 
-                glyphNode->setFlags( QSGNode::OwnedByParent | GlyphFlag );
-            }
+        QTextOption textOption( alignment );
+        textOption.setWrapMode( static_cast< QTextOption::WrapMode >( options.wrapMode() ) );
 
-            glyphNode->setStyle( style );
-            glyphNode->setColor( color );
-            glyphNode->setStyleColor( styleColor );
-            glyphNode->setGlyphs( position, glyphRun );
-            glyphNode->update();
+        QTextLayout layout;
+        layout.setFont( font );
+        layout.setTextOption( textOption );
+        layout.setText( tmp );
 
-            if ( glyphNode->parent() != parentNode )
-                parentNode->appendChildNode( glyphNode );
+        layout.beginLayout();
+        textLayout.height = qskLayoutText( &layout, width, options );
+        layout.endLayout();
 
-            glyphNode = static_cast< QSGGlyphNode* >( glyphNode->nextSibling() );
-        }
-    }
+        textLayout.boundingHeight = layout.boundingRect().height();
 
-    // Remove leftover glyphs
-    while ( glyphNode )
-    {
-        auto sibling = glyphNode->nextSibling();
-        if ( glyphNode->flags() & GlyphFlag )
+        for ( int i = 0; i < layout.lineCount(); ++i )
         {
-            parentNode->removeChildNode( glyphNode );
-            delete glyphNode;
-        }
-        glyphNode = static_cast< QSGGlyphNode* >( sibling );
-    }
-}
+            const auto line = layout.lineAt( i );
 
-void QskPlainTextRenderer::updateNode( const QString& text,
-    const QFont& font, const QskTextOptions& options,
-    Qsk::TextStyle style, const QskTextColors& colors,
-    Qt::Alignment alignment, const QRectF& rect,
-    const QQuickItem* item, QSGTransformNode* node )
-{
-    QTextOption textOption( alignment );
-    textOption.setWrapMode( static_cast< QTextOption::WrapMode >( options.wrapMode() ) );
-
-    QString tmp = text;
-
-#if 0
-    const int pos = tmp.indexOf( QLatin1Char( '\x9c' ) );
-    if ( pos != -1 )
-    {
-        // ST: string termination
+            textLayout.width = qMax( textLayout.width, line.naturalTextWidth() );
+            textLayout.glyphRuns += line.glyphRuns();
+        }
 
-        tmp = tmp.mid( 0, pos );
-        tmp.replace( QLatin1Char( '\n' ), QChar::LineSeparator );
-    }
-    else
-#endif
-    if ( tmp.contains( QLatin1Char( '\n' ) ) )
-    {
-        tmp.replace( QLatin1Char('\n'), QChar::LineSeparator );
+        QskTextCache::insertLayout( key, textLayout );
     }
 
+    return textLayout;
+}
 
-    QTextLayout layout;
-    layout.setFont( font );
-    layout.setTextOption( textOption );
-    layout.setText( tmp );
+QSizeF QskPlainTextRenderer::textSize(
+    const QString& text, const QFont& font, const QskTextOptions& options )
+{
+    // result differs from QQuickText::implicitSizeHint ???
+    return textRect( text, font, options, QSizeF( 10e6, 10e6 ) ).size();
+}
 
-    layout.beginLayout();
-    const qreal textHeight = qskLayoutText( &layout, rect.width(), options );
-    layout.endLayout();
+QRectF QskPlainTextRenderer::textRect(
+    const QString& text, const QFont& font, const QskTextOptions& options,
+    const QSizeF& size )
+{
+    /*
+        The size is taken from the same QTextLayout, that is used for the
+        glyph nodes, so that a text is shaped only once, when being
+        rendered with the width of the constraint. The width is limited
+        as QTextLine uses fixed point values, that would overflow.
+     */
+    auto width = size.width();
+    if ( width < 0.0 || width > 10e6 )
+        width = 10e6;
+
+    const auto textLayout = qskTextLayout(
+        text, font, options, Qt::AlignLeft, width );
+
+    return QRectF( 0.0, 0.0, textLayout.width, textLayout.height );
+}
 
+static qreal qskBaseLine( const QskTextCache::Layout& textLayout,
+    const QFont& font, Qt::Alignment alignment, qreal height )
+{
+    const qreal textHeight = textLayout.height;
     const qreal y0 = QFontMetricsF( font ).ascent();
 
     qreal yBaseline = y0;
 
     if ( alignment & Qt::AlignVCenter )
     {
-        yBaseline += ( rect.height() - textHeight ) * 0.5;
+        yBaseline += ( height - textHeight ) * 0.5;
     }
     else if ( alignment & Qt::AlignBottom )
     {
-        yBaseline += rect.height() - textHeight;
+        yBaseline += height - textHeight;
     }
 
     if ( yBaseline != y0 )
@@ -235,30 +192,57 @@ void QskPlainTextRenderer::updateNode( const QString& text,
             between margins/paddings.
          */
 
-        const int bh = int( layout.boundingRect().height() );
+        const int bh = int( textLayout.boundingHeight );
         yBaseline = ( bh % 2 ) ? qFloor( yBaseline ) : qCeil( yBaseline );
     }
 
-    qskRenderText(
-        const_cast< QQuickItem* >( item ), node, layout, yBaseline,
-        colors.textColor(), static_cast< QQuickText::TextStyle >( style ),
-        colors.styleColor() );
+    return yBaseline;
+}
+
+void QskPlainTextRenderer::updateNode( const QString& text,
+    const QFont& font, const QskTextOptions& options,
+    Qsk::TextStyle style, const QskTextColors& colors,
+    Qt::Alignment alignment, const QRectF& rect,
+    const QQuickItem* item, QSGTransformNode* node )
+{
+    const auto textLayout = qskTextLayout(
+        text, font, options, alignment, rect.width() );
+
+    const auto yBaseline = qskBaseLine( textLayout, font, alignment, rect.height() );
+
+    QskGlyphNodes::updateNodes( item, node, textLayout.glyphRuns,
+        QPointF( 0.0, yBaseline ), colors.textColor(), QVector< QColor >(),
+        style, colors.styleColor(), options.renderType() );
+}
+
+QList< QGlyphRun > QskPlainTextRenderer::glyphRuns( const QString& text,
+    const QFont& font, const QskTextOptions& options,
+    Qt::Alignment alignment, const QRectF& rect )
+{
+    const auto textLayout = qskTextLayout(
+        text, font, options, alignment, rect.width() );
+
+    const QPointF offset( rect.x(),
+        rect.y() + qskBaseLine( textLayout, font, alignment, rect.height() ) );
+
+    auto glyphRuns = textLayout.glyphRuns;
+
+    for ( auto& glyphRun : glyphRuns )
+    {
+        auto positions = glyphRun.positions();
+        for ( auto& pos : positions )
+            pos += offset;
+
+        glyphRun.setPositions( positions );
+        glyphRun.setBoundingRect( glyphRun.boundingRect().translated( offset ) );
+    }
+
+    return glyphRuns;
 }
 
 void QskPlainTextRenderer::updateNodeColor(
     QSGNode* parentNode, const QColor& textColor,
     Qsk::TextStyle style, const QColor& styleColor )
 {
-    auto glyphNode = static_cast< QSGGlyphNode* >( parentNode->firstChild() );
-    while ( glyphNode )
-    {
-        if ( glyphNode->flags() & GlyphFlag )
-        {
-            glyphNode->setColor( textColor );
-            glyphNode->setStyle( static_cast< QQuickText::TextStyle >( style ) );
-            glyphNode->setStyleColor( styleColor );
-            glyphNode->update();
-        }
-        glyphNode = static_cast< QSGGlyphNode* >( glyphNode->nextSibling() );
-    }
+    QskGlyphNodes::updateColors( parentNode, textColor, style, styleColor );
 }
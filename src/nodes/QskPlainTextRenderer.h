@@ -8,6 +8,7 @@
 
 #include "QskNamespace.h"
 #include <qnamespace.h>
+#include <qlist.h>
 
 class QskTextColors;
 class QskTextOptions;
@@ -20,6 +21,7 @@ class QQuickItem;
 class QColor;
 class QSGTransformNode;
 class QSGNode;
+class QGlyphRun;
 
 namespace QskPlainTextRenderer
 {
@@ -37,6 +39,10 @@ namespace QskPlainTextRenderer
 
     QSK_EXPORT QRectF textRect( const QString&,
         const QFont&, const QskTextOptions&, const QSizeF& );
+
+    // the glyph runs of the text, positioned inside of the rectangle
+    QSK_EXPORT QList< QGlyphRun > glyphRuns( const QString&,
+        const QFont&, const QskTextOptions&, Qt::Alignment, const QRectF& );
 }
 
 #endif
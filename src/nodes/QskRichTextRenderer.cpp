@@ -6,10 +6,20 @@
 #include "QskRichTextRenderer.h"
 #include "QskTextColors.h"
 #include "QskTextOptions.h"
+#include "QskTextCache.h"
+#include "QskGlyphNodes.h"
 #include "QskInternalMacros.h"
 
+#include <qabstracttextdocumentlayout.h>
 #include <qglobalstatic.h>
+#include <qglyphrun.h>
+#include <qmath.h>
 #include <qmutex.h>
+#include <qrawfont.h>
+#include <qsgsimplerectnode.h>
+#include <qtextdocument.h>
+#include <qtextlayout.h>
+#include <qtextobject.h>
 #include <qthread.h>
 
 class QQuickWindow;
@@ -19,7 +29,37 @@ QSK_QT_PRIVATE_BEGIN
 #include <private/qquicktext_p_p.h>
 QSK_QT_PRIVATE_END
 
-// Since Qt 5.7 QQuickTextNode is public and could be used TODO ...
+/*
+    The text is laid out with a QTextDocument and the glyph runs of its
+    fragments are passed to QSGGlyphNodes - including the text style
+    ( Qsk::Outline, Qsk::Raised ... ) and the colors of links.
+
+    The QskTextOptions::StyledText format, inline images, elided texts
+    and maximumLineCount are not supported by this implementation and
+    are still rendered by a hidden QQuickText.
+ */
+
+static bool qskIsDocumentSupported(
+    const QString& text, const QskTextOptions& options )
+{
+    if ( options.elideMode() != Qt::ElideNone )
+        return false;
+
+    if ( options.maximumLineCount() != std::numeric_limits< int >::max() )
+        return false;
+
+    switch( options.effectiveFormat( text ) )
+    {
+        case QskTextOptions::MarkdownText:
+            return !text.contains( QStringLiteral( "![" ) );
+
+        case QskTextOptions::RichText:
+            return !text.contains( QStringLiteral( "<img" ), Qt::CaseInsensitive );
+
+        default:
+            return false;
+    }
+}
 
 namespace
 {
@@ -40,19 +80,6 @@ namespace
             // fonts are supposed to be defined in the application skin and we
             // probably don't want to have them scaled
             setFontSizeMode( QQuickText::FixedSize );
-
-#if 0
-            setAntialiasing( true );
-            setRenderType( QQuickText::QtRendering );
-            setPadding( 0 );
-
-            setMinimumPixelSize();
-            setMinimumPointSize();
-
-            // also something, that should be defined in an application skin
-            setLineHeightMode( ... );
-            setLineHeight();
-#endif
         }
 
         inline void setGeometry( const QRectF& rect )
@@ -189,7 +216,7 @@ namespace
  */
 Q_GLOBAL_STATIC( TextItemMap, qskTextItemMap )
 
-QSizeF QskRichTextRenderer::textSize(
+static QSizeF qskItemTextSize(
     const QString& text, const QFont& font, const QskTextOptions& options )
 {
     auto& textItem = *qskTextItemMap->item();
@@ -211,8 +238,7 @@ QSizeF QskRichTextRenderer::textSize(
     return sz;
 }
 
-QRectF QskRichTextRenderer::textRect(
-    const QString& text, const QFont& font,
+static QRectF qskItemTextRect( const QString& text, const QFont& font,
     const QskTextOptions& options, const QSizeF& size )
 {
     auto& textItem = *qskTextItemMap->item();
@@ -237,15 +263,12 @@ QRectF QskRichTextRenderer::textRect(
     return rect;
 }
 
-void QskRichTextRenderer::updateNode(
+static void qskItemUpdateNode(
     const QString& text, const QFont& font,
     const QskTextOptions& options, Qsk::TextStyle style,
     const QskTextColors& colors, Qt::Alignment alignment,
     const QRectF& rect, const QQuickItem* item, QSGTransformNode* node )
 {
-    // are we killing internal caches of QQuickText, when always using
-    // the same item for the creation the text nodes. TODO ...
-
     auto& textItem = *qskTextItemMap->item();
 
     textItem.begin();
@@ -292,3 +315,204 @@ void QskRichTextRenderer::updateNode(
     textItem.updateTextNode( item->window(), node );
     textItem.reset();
 }
+
+static void qskInitDocument( QTextDocument& document,
+    const QString& text, const QFont& font, const QskTextOptions& options,
+    Qt::Alignment alignment, qreal textWidth )
+{
+    document.setDocumentMargin( 0.0 );
+    document.setDefaultFont( font );
+
+    QTextOption textOption( alignment & Qt::AlignHorizontal_Mask );
+    textOption.setWrapMode( static_cast< QTextOption::WrapMode >( options.wrapMode() ) );
+    document.setDefaultTextOption( textOption );
+
+    if ( options.effectiveFormat( text ) == QskTextOptions::MarkdownText )
+        document.setMarkdown( text );
+    else
+        document.setHtml( text );
+
+    document.setTextWidth( textWidth );
+}
+
+static QskTextCache::Layout qskLayoutDocument( QTextDocument& document )
+{
+    QskTextCache::Layout layout;
+
+    // forcing the document to be laid out
+    layout.height = layout.boundingHeight = document.size().height();
+
+    for ( auto block = document.begin(); block.isValid(); block = block.next() )
+    {
+        const auto blockLayout = block.layout();
+        if ( blockLayout == nullptr || !block.isVisible() )
+            continue;
+
+        // the glyph positions are relative to the layout of the block
+        const auto offset = blockLayout->position();
+
+        for ( auto it = block.begin(); !it.atEnd(); ++it )
+        {
+            const auto fragment = it.fragment();
+            if ( !fragment.isValid() )
+                continue;
+
+            const auto format = fragment.charFormat();
+
+            QColor color;
+            if ( format.hasProperty( QTextFormat::ForegroundBrush ) )
+                color = format.foreground().color();
+
+            // links have an explicit color from the HTML import
+            const bool isLink = format.isAnchor();
+
+            auto glyphRuns = fragment.glyphRuns();
+            for ( auto& glyphRun : glyphRuns )
+            {
+                auto positions = glyphRun.positions();
+                for ( auto& pos : positions )
+                    pos += offset;
+
+                glyphRun.setPositions( positions );
+                glyphRun.setBoundingRect( glyphRun.boundingRect().translated( offset ) );
+
+                if ( isLink )
+                    layout.linkRuns += layout.glyphRuns.count();
+
+                layout.glyphRuns += glyphRun;
+                layout.runColors += color;
+            }
+        }
+    }
+
+    return layout;
+}
+
+static void qskAppendDecorations( QSGNode* parentNode,
+    const QList< QGlyphRun >& glyphRuns, const QVector< QColor >& colors,
+    const QPointF& position )
+{
+    for ( int i = 0; i < glyphRuns.count(); i++ )
+    {
+        const auto& glyphRun = glyphRuns[i];
+
+        if ( !( glyphRun.underline() || glyphRun.overline() || glyphRun.strikeOut() ) )
+            continue;
+
+        const auto positions = glyphRun.positions();
+        if ( positions.isEmpty() )
+            continue;
+
+        const auto rawFont = glyphRun.rawFont();
+
+        const auto r = glyphRun.boundingRect().translated( position );
+        const auto baseLine = positions.first().y() + position.y();
+        const auto lineWidth = qMax( rawFont.lineThickness(), 1.0 );
+
+        auto addLine = [&]( qreal y )
+        {
+            auto node = new QSGSimpleRectNode(
+                QRectF( r.left(), y, r.width(), lineWidth ), colors[i] );
+            parentNode->appendChildNode( node );
+        };
+
+        if ( glyphRun.underline() )
+            addLine( baseLine + rawFont.underlinePosition() );
+
+        if ( glyphRun.overline() )
+            addLine( baseLine - rawFont.ascent() );
+
+        if ( glyphRun.strikeOut() )
+            addLine( baseLine - rawFont.xHeight() / 2 );
+    }
+}
+
+QSizeF QskRichTextRenderer::textSize(
+    const QString& text, const QFont& font, const QskTextOptions& options )
+{
+    if ( !qskIsDocumentSupported( text, options ) )
+        return qskItemTextSize( text, font, options );
+
+    QTextDocument document;
+    qskInitDocument( document, text, font, options, Qt::Alignment(), -1.0 );
+
+    return QSizeF( document.idealWidth(), document.size().height() );
+}
+
+QRectF QskRichTextRenderer::textRect(
+    const QString& text, const QFont& font,
+    const QskTextOptions& options, const QSizeF& size )
+{
+    if ( !qskIsDocumentSupported( text, options ) )
+        return qskItemTextRect( text, font, options, size );
+
+    QTextDocument document;
+    qskInitDocument( document, text, font, options, Qt::Alignment(), size.width() );
+
+    const auto w = qMin( document.idealWidth(), size.width() );
+    return QRectF( 0.0, 0.0, w, document.size().height() );
+}
+
+void QskRichTextRenderer::updateNode(
+    const QString& text, const QFont& font,
+    const QskTextOptions& options, Qsk::TextStyle style,
+    const QskTextColors& colors, Qt::Alignment alignment,
+    const QRectF& rect, const QQuickItem* item, QSGTransformNode* node )
+{
+    if ( !qskIsDocumentSupported( text, options ) )
+    {
+        qskItemUpdateNode( text, font, options, style,
+            colors, alignment, rect, item, node );
+        return;
+    }
+
+    const QskTextCache::Key key( QskTextCache::Key::TextLayout,
+        text, font, options, QSizeF( rect.width(), 0.0 ),
+        alignment & Qt::AlignHorizontal_Mask );
+
+    QskTextCache::Layout layout;
+
+    if ( !QskTextCache::findLayout( key, layout ) )
+    {
+        QTextDocument document;
+        qskInitDocument( document, text, font, options, alignment, rect.width() );
+
+        layout = qskLayoutDocument( document );
+        QskTextCache::insertLayout( key, layout );
+    }
+
+    auto runColors = layout.runColors;
+    for ( const auto index : std::as_const( layout.linkRuns ) )
+        runColors[ index ] = colors.linkColor();
+
+    qreal y = 0.0;
+
+    if ( alignment & ( Qt::AlignVCenter | Qt::AlignBottom ) )
+    {
+        y = rect.height() - layout.height;
+
+        if ( alignment & Qt::AlignVCenter )
+        {
+            /*
+                We need to have a stable algo for rounding the text base line,
+                so that texts don't start wobbling, when processing transitions
+                between margins/paddings.
+             */
+            y = qFloor( 0.5 * y );
+        }
+    }
+
+    const QPointF position( 0.0, y );
+
+    QskGlyphNodes::updateNodes( item, node, layout.glyphRuns,
+        position, colors.textColor(), runColors, style,
+        colors.styleColor(), options.renderType() );
+
+    for ( auto& color : runColors )
+    {
+        if ( !color.isValid() )
+            color = colors.textColor();
+    }
+
+    qskAppendDecorations( node, layout.glyphRuns, runColors, position );
+}
@@ -8,6 +8,7 @@
 #include "QskGradientDirection.h"
 #include "QskVertex.h"
 #include "QskFillNodePrivate.h"
+#include "QskTriangulationCache.h"
 #include "QskInternalMacros.h"
 
 QSK_QT_PRIVATE_BEGIN
@@ -37,10 +38,23 @@ static void qskUpdateGeometry( const QPainterPath& path,
 
 #else
 
-static void qskUpdateGeometry( const QPainterPath& path,
-    const QTransform& transform, const QColor& color, QSGGeometry& geometry )
+static QskTriangulationCache::Vertices qskTriangulate(
+    const QPainterPath& path, const QTransform& transform )
 {
-    const auto ts = qTriangulate( path, transform, 1, false );
+    /*
+        The path is triangulated in the resolution of the scale bucket
+        of the transformation, but the vertices are stored in path
+        coordinates. So we have cache hits as long as the path does not change
+        - regardless of any translation or moderate scaling.
+     */
+    const auto scale = QskTriangulationCache::scaleBucket( transform );
+    const QskTriangulationCache::Key key( path, QTransform::fromScale( scale, scale ) );
+
+    QskTriangulationCache::Vertices vertices;
+    if ( QskTriangulationCache::find( key, vertices ) )
+        return vertices;
+
+    const auto ts = qTriangulate( path, QTransform::fromScale( scale, scale ), 1, false );
 
     /*
         The triangulation of a random path usually does not lead to index lists
@@ -60,26 +74,52 @@ static void qskUpdateGeometry( const QPainterPath& path,
     const auto points = ts.vertices.constData();
     const auto indices = reinterpret_cast< const quint16* >( ts.indices.data() );
 
-    geometry.allocate( ts.indices.size() );
+    vertices.resize( 2 * ts.indices.size() );
+
+    auto v = vertices.data();
+    for ( int i = 0; i < ts.indices.size(); i++ )
+    {
+        const int j = 2 * indices[i];
+
+        *v++ = points[j] / scale;
+        *v++ = points[j + 1] / scale;
+    }
+
+    QskTriangulationCache::insert( key, vertices );
+
+    return vertices;
+}
+
+static void qskUpdateGeometry( const QPainterPath& path,
+    const QTransform& transform, const QColor& color, QSGGeometry& geometry )
+{
+    const auto vertices = qskTriangulate( path, transform );
+    const auto v = vertices.constData();
+
+    geometry.allocate( vertices.size() / 2 );
 
     if ( color.isValid() )
     {
         const QskVertex::Color c = color;
 
         auto vertexData = geometry.vertexDataAsColoredPoint2D();
-        for ( int i = 0; i < ts.indices.size(); i++ )
+        for ( int i = 0; i < geometry.vertexCount(); i++ )
         {
-            const int j = 2 * indices[i];
-            vertexData[i].set( points[j], points[j + 1], c.r, c.g, c.b, c.a );
+            qreal x, y;
+            transform.map( v[2 * i], v[2 * i + 1], &x, &y );
+
+            vertexData[i].set( x, y, c.r, c.g, c.b, c.a );
         }
     }
     else
     {
         auto vertexData = geometry.vertexDataAsPoint2D();
-        for ( int i = 0; i < ts.indices.size(); i++ )
+        for ( int i = 0; i < geometry.vertexCount(); i++ )
         {
-            const int j = 2 * indices[i];
-            vertexData[i].set( points[j], points[j + 1] );
+            qreal x, y;
+            transform.map( v[2 * i], v[2 * i + 1], &x, &y );
+
+            vertexData[i].set( x, y );
         }
     }
 }
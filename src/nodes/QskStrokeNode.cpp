@@ -7,6 +7,8 @@
 #include "QskVertex.h"
 #include "QskGradient.h"
 #include "QskRgbValue.h"
+#include "QskTriangulationCache.h"
+#include "QskFillNodePrivate.h"
 #include "QskInternalMacros.h"
 
 #include <qpainterpath.h>
@@ -33,7 +35,117 @@ static inline bool qskIsPenVisible( const QPen& pen )
     return true;
 }
 
+static QskTriangulationCache::Vertices qskStroke(
+    const QPainterPath& path, const QTransform& transform, const QPen& pen )
+{
+    /*
+        Unfortunately QTriangulatingStroker does not offer on the fly
+        transformations - like with qTriangulate.
+     */
+    const auto scaledPath = transform.map( path );
+
+    auto effectivePen = pen;
+
+    if ( !effectivePen.isCosmetic() )
+    {
+        const auto scaleFactor = qMin( transform.m11(), transform.m22() );
+        if ( scaleFactor != 1.0 )
+        {
+            effectivePen.setWidth( effectivePen.widthF() * scaleFactor );
+            effectivePen.setCosmetic( false );
+        }
+    }
+
+    QTriangulatingStroker stroker;
+
+    if ( pen.style() == Qt::SolidLine )
+    {
+        // clipRect, renderHint are ignored in QTriangulatingStroker::process
+        stroker.process( qtVectorPathForPath( scaledPath ), effectivePen, {}, {} );
+    }
+    else
+    {
+        constexpr QRectF clipRect; // empty rect: no clipping
+
+        QDashedStrokeProcessor dashStroker;
+        dashStroker.process( qtVectorPathForPath( scaledPath ),
+            effectivePen, clipRect, {} );
+
+        const QVectorPath dashedVectorPath( dashStroker.points(),
+            dashStroker.elementCount(), dashStroker.elementTypes(), 0 );
+
+        stroker.process( dashedVectorPath, effectivePen, {}, {} );
+    }
+
+    QskTriangulationCache::Vertices vertices( stroker.vertexCount() );
+    if ( !vertices.isEmpty() )
+    {
+        memcpy( vertices.data(), stroker.vertices(),
+            stroker.vertexCount() * sizeof( float ) );
+    }
+
+    return vertices;
+}
+
+static QskTriangulationCache::Vertices qskStroke(
+    const QPainterPath& path, const QPen& pen,
+    const QTransform& transform, QTransform& vertexTransform )
+{
+    /*
+        The stroke is calculated for a transformation without translation.
+        When scaling uniformly with a non cosmetic pen we can also
+        use the scale bucket and rescale the vertices.
+        Then the translation/scaling is applied to the cached vertices.
+     */
+
+    QTransform strokeTransform;
+
+    const bool isUniform = transform.type() <= QTransform::TxScale
+        && transform.m11() == transform.m22() && transform.m11() > 0.0
+        && !pen.isCosmetic();
+
+    if ( isUniform )
+    {
+        const auto scale = QskTriangulationCache::scaleBucket( transform );
+        strokeTransform = QTransform::fromScale( scale, scale );
+
+        const auto f = transform.m11() / scale;
+        vertexTransform = QTransform( f, 0.0, 0.0, f, transform.dx(), transform.dy() );
+    }
+    else if ( transform.type() == QTransform::TxProject )
+    {
+        strokeTransform = transform;
+        vertexTransform = QTransform();
+    }
+    else
+    {
+        strokeTransform = QTransform( transform.m11(), transform.m12(), transform.m13(),
+            transform.m21(), transform.m22(), transform.m23(),
+            0.0, 0.0, transform.m33() );
+
+        vertexTransform = QTransform::fromTranslate( transform.dx(), transform.dy() );
+    }
+
+    const QskTriangulationCache::Key key( path, strokeTransform, pen );
+
+    QskTriangulationCache::Vertices vertices;
+    if ( !QskTriangulationCache::find( key, vertices ) )
+    {
+        vertices = qskStroke( path, strokeTransform, pen );
+        QskTriangulationCache::insert( key, vertices );
+    }
+
+    return vertices;
+}
+
+class QskStrokeNodePrivate final : public QskFillNodePrivate
+{
+  public:
+    QskHashValue hash = 0;
+};
+
 QskStrokeNode::QskStrokeNode()
+    : QskFillNode( *new QskStrokeNodePrivate )
 {
 }
 
@@ -47,9 +159,13 @@ void QskStrokeNode::updatePath( const QPainterPath& path, const QPen& pen )
 void QskStrokeNode::updatePath(
     const QPainterPath& path, const QTransform& transform, const QPen& pen )
 {
+    Q_D( QskStrokeNode );
+
     if ( path.isEmpty() || !qskIsPenVisible( pen ) )
     {
+        d->hash = 0;
         resetGeometry();
+
         return;
     }
 
@@ -65,73 +181,64 @@ void QskStrokeNode::updatePath(
     else
         setColoring( pen.color() );
 
-    if ( true ) // For the moment we always update the geometry. TODO ...
-    {
-        /*
-            Unfortunately QTriangulatingStroker does not offer on the fly
-            transformations - like with qTriangulate. TODO ...
-         */
-        const auto scaledPath = transform.map( path );
+    auto hash = QskTriangulationCache::transformHash( transform, 17569 );
+    hash = QskTriangulationCache::penHash( pen, hash );
+    hash = QskTriangulationCache::pathHash( path, hash );
+    hash = qHash( isGeometryColored(), hash );
 
-        auto effectivePen = pen;
+    if ( isGeometryColored() )
+        hash = qHash( pen.color().rgba(), hash );
 
-        if ( !effectivePen.isCosmetic() )
-        {
-            const auto scaleFactor = qMin( transform.m11(), transform.m22() );
-            if ( scaleFactor != 1.0 )
-            {
-                effectivePen.setWidth( effectivePen.widthF() * scaleFactor );
-                effectivePen.setCosmetic( false );
-            }
-        }
+    if ( hash == d->hash )
+        return;
 
-        QTriangulatingStroker stroker;
+    d->hash = hash;
 
-        if ( pen.style() == Qt::SolidLine )
-        {
-            // clipRect, renderHint are ignored in QTriangulatingStroker::process
-            stroker.process( qtVectorPathForPath( scaledPath ), effectivePen, {}, {} );
-        }
-        else
-        {
-            constexpr QRectF clipRect; // empty rect: no clipping
+    QTransform vertexTransform;
+    const auto vertices = qskStroke( path, pen, transform, vertexTransform );
 
-            QDashedStrokeProcessor dashStroker;
-            dashStroker.process( qtVectorPathForPath( scaledPath ),
-                effectivePen, clipRect, {} );
+    const auto v = vertices.constData();
 
-            const QVectorPath dashedVectorPath( dashStroker.points(),
-                dashStroker.elementCount(), dashStroker.elementTypes(), 0 );
+    auto& geometry = *this->geometry();
 
-            stroker.process( dashedVectorPath, effectivePen, {}, {} );
-        }
+    // 2 vertices for each point
+    geometry.setDrawingMode( QSGGeometry::DrawTriangleStrip );
+    geometry.allocate( vertices.size() / 2 );
 
-        auto& geometry = *this->geometry();
+    if ( isGeometryColored() )
+    {
+        const QskVertex::Color c( pen.color() );
 
-        // 2 vertices for each point
-        geometry.setDrawingMode( QSGGeometry::DrawTriangleStrip );
-        geometry.allocate( stroker.vertexCount() / 2 );
+        auto points = geometry.vertexDataAsColoredPoint2D();
 
-        if ( isGeometryColored() )
+        for ( int i = 0; i < geometry.vertexCount(); i++ )
         {
-            const QskVertex::Color c( pen.color() );
+            qreal x, y;
+            vertexTransform.map( v[2 * i], v[2 * i + 1], &x, &y );
 
-            const auto v = stroker.vertices();
-            auto points = geometry.vertexDataAsColoredPoint2D();
+            points[i].set( x, y, c.r, c.g, c.b, c.a );
+        }
+    }
+    else
+    {
+        if ( vertexTransform.isIdentity() )
+        {
+            memcpy( geometry.vertexData(), v, vertices.size() * sizeof( float ) );
+        }
+        else
+        {
+            auto points = geometry.vertexDataAsPoint2D();
 
             for ( int i = 0; i < geometry.vertexCount(); i++ )
             {
-                const auto j = 2 * i;
-                points[i].set( v[j], v[j + 1], c.r, c.g, c.b, c.a );
+                qreal x, y;
+                vertexTransform.map( v[2 * i], v[2 * i + 1], &x, &y );
+
+                points[i].set( x, y );
             }
         }
-        else
-        {
-            memcpy( geometry.vertexData(), stroker.vertices(),
-                stroker.vertexCount() * sizeof( float ) );
-        }
-
-        geometry.markVertexDataDirty();
-        markDirty( QSGNode::DirtyGeometry );
     }
+
+    geometry.markVertexDataDirty();
+    markDirty( QSGNode::DirtyGeometry );
 }
@@ -0,0 +1,75 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) The authors
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#include "QskTessellation.h"
+
+#include <qguiapplication.h>
+#include <qhash.h>
+#include <qquickwindow.h>
+#include <qmath.h>
+
+#include <atomic>
+
+/*
+    For rounded corners the default of 0.1 pixels results in about
+    the number of segments we had, when using a segment for every 3 pixels
+    of the arc length ( max. 18 ) for radii in the range of [10, 100].
+
+    As the number of segments grows with the square root of the radius
+    longer arcs end up with less segments than before: f.e. 71 instead of 160
+    for a full circle with a radius of 100 pixels.
+ */
+static std::atomic< qreal > qskTolerance { 0.1 };
+
+void QskTessellation::setTolerance( qreal tolerance )
+{
+    qskTolerance = qBound( 0.01, tolerance, 10.0 );
+}
+
+qreal QskTessellation::tolerance()
+{
+    return qskTolerance;
+}
+
+int QskTessellation::arcSegmentCount(
+    qreal radius, qreal radians, qreal devicePixelRatio )
+{
+    radians = qAbs( radians );
+
+    const int minCount = 3;
+
+    // limiting the resolution to 1 segment per degree
+    const int maxCount = qMax( minCount, qCeil( qRadiansToDegrees( radians ) ) );
+
+    const auto r = radius * devicePixelRatio;
+    const auto tolerance = qskTolerance.load();
+
+    if ( r <= tolerance )
+        return minCount;
+
+    /*
+        The maximum distance between an arc and its chord is
+        r * ( 1 - cos( angle / 2 ) ) ( = sagitta ).
+     */
+    const auto angle = 2.0 * std::acos( 1.0 - tolerance / r );
+    if ( !( angle > 0.0 ) )
+        return maxCount;
+
+    return qBound( minCount, qCeil( radians / angle ), maxCount );
+}
+
+qreal QskTessellation::devicePixelRatio( const QQuickWindow* window )
+{
+    if ( window )
+        return window->effectiveDevicePixelRatio();
+
+    return qGuiApp ? qGuiApp->devicePixelRatio() : 1.0;
+}
+
+QskHashValue QskTessellation::hash( qreal devicePixelRatio, QskHashValue seed )
+{
+    const auto hash = qHash( devicePixelRatio, seed );
+    return qHash( qskTolerance.load(), hash );
+}
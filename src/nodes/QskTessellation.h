@@ -0,0 +1,44 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) The authors
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#ifndef QSK_TESSELLATION_H
+#define QSK_TESSELLATION_H
+
+#include "QskGlobal.h"
+
+class QQuickWindow;
+
+/*
+    Arcs and rounded corners are approximated by polylines. The number of
+    segments is calculated from the size of the arc in device pixels,
+    so that the distance between the arc and its approximation never
+    exceeds a tolerance.
+
+    A higher tolerance results in less vertices, what might be an option
+    for low-end GPUs. A lower tolerance gives better results for huge arcs.
+
+    The tolerance is a global setting for all windows. Nodes include it
+    in the hash of their metrics, so that their geometries are rebuilt
+    on their next update: QskSetup::setTessellationTolerance
+    also schedules an update for all items.
+ */
+namespace QskTessellation
+{
+    // in device pixels
+    QSK_EXPORT void setTolerance( qreal );
+    QSK_EXPORT qreal tolerance();
+
+    // at least 3 segments
+    QSK_EXPORT int arcSegmentCount( qreal radius,
+        qreal radians, qreal devicePixelRatio = 1.0 );
+
+    // without a window the ratio of the application is used
+    QSK_EXPORT qreal devicePixelRatio( const QQuickWindow* );
+
+    // hash of the parameters affecting the number of segments
+    QSK_EXPORT QskHashValue hash( qreal devicePixelRatio, QskHashValue seed = 0 );
+}
+
+#endif
@@ -0,0 +1,195 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) The authors
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#include "QskTextCache.h"
+
+#include <qcache.h>
+#include <qmutex.h>
+#include <qglobalstatic.h>
+
+#include <atomic>
+
+static std::atomic< int > qskCacheSize { 1000 };
+
+static std::atomic< quint64 > qskHits { 0 };
+static std::atomic< quint64 > qskMisses { 0 };
+
+namespace
+{
+    class SizeCache
+    {
+      public:
+        SizeCache()
+        {
+            cache.setMaxCost( qskCacheSize );
+        }
+
+        QCache< QskTextCache::Key, QSizeF > cache;
+        QMutex mutex;
+    };
+
+    /*
+        Glyph runs are bound to the thread, where they have been created,
+        so the layouts are never shared and do not need a mutex.
+     */
+    class LayoutCache
+    {
+      public:
+        QCache< QskTextCache::Key, QskTextCache::Layout >& effectiveCache()
+        {
+            const int size = qskCacheSize;
+            if ( cache.maxCost() != size )
+                cache.setMaxCost( size );
+
+            return cache;
+        }
+
+        QCache< QskTextCache::Key, QskTextCache::Layout > cache;
+    };
+}
+
+Q_GLOBAL_STATIC( SizeCache, qskSizeCache )
+static thread_local LayoutCache qskLayoutCache;
+
+template< typename T >
+static inline const T* qskFind(
+    const QCache< QskTextCache::Key, T >& cache, const QskTextCache::Key& key )
+{
+    const auto object = cache.object( key );
+
+    if ( object )
+        qskHits++;
+    else
+        qskMisses++;
+
+    return object;
+}
+
+QskTextCache::Key::Key( Type type, const QString& text,
+        const QFont& font, const QskTextOptions& options )
+    : Key( type, text, font, options, QSizeF() )
+{
+    isConstrained = false;
+}
+
+QskTextCache::Key::Key( Type type, const QString& text, const QFont& font,
+        const QskTextOptions& options, const QSizeF& size, int alignment )
+    : text( text )
+    , font( font )
+    , options( options )
+    , size( size )
+    , alignment( alignment )
+    , type( type )
+    , isConstrained( true )
+{
+    // sizes and glyph runs do not depend on how the glyphs are rendered
+    this->options.setRenderType( QskTextOptions::DefaultRendering );
+}
+
+bool QskTextCache::Key::operator==( const Key& other ) const noexcept
+{
+    return ( type == other.type ) && ( isConstrained == other.isConstrained )
+        && ( alignment == other.alignment ) && ( size == other.size )
+        && ( options == other.options ) && ( text == other.text )
+        && ( font == other.font );
+}
+
+QskHashValue QskTextCache::qHash( const Key& key, QskHashValue seed ) noexcept
+{
+    auto hash = ::qHash( key.text, seed );
+    hash = ::qHash( key.font, hash );
+    hash = key.options.hash( hash );
+    hash = ::qHash( key.size.width(), hash );
+    hash = ::qHash( key.size.height(), hash );
+    hash = ::qHash( key.alignment, hash );
+    hash = ::qHash( static_cast< int >( key.type ), hash );
+    hash = ::qHash( key.isConstrained, hash );
+
+    return hash;
+}
+
+bool QskTextCache::findSize( const Key& key, QSizeF& size )
+{
+    auto cache = qskSizeCache();
+
+    QMutexLocker locker( &cache->mutex );
+
+    if ( const auto cachedSize = qskFind( cache->cache, key ) )
+    {
+        size = *cachedSize;
+        return true;
+    }
+
+    return false;
+}
+
+void QskTextCache::insertSize( const Key& key, const QSizeF& size )
+{
+    auto cache = qskSizeCache();
+
+    QMutexLocker locker( &cache->mutex );
+    cache->cache.insert( key, new QSizeF( size ) );
+}
+
+bool QskTextCache::findLayout( const Key& key, Layout& layout )
+{
+    if ( const auto cachedLayout = qskFind( qskLayoutCache.effectiveCache(), key ) )
+    {
+        layout = *cachedLayout;
+        return true;
+    }
+
+    return false;
+}
+
+void QskTextCache::insertLayout( const Key& key, const Layout& layout )
+{
+    qskLayoutCache.effectiveCache().insert( key, new Layout( layout ) );
+}
+
+void QskTextCache::setCacheSize( int size )
+{
+    size = qMax( size, 0 );
+    qskCacheSize = size;
+
+    auto cache = qskSizeCache();
+
+    QMutexLocker locker( &cache->mutex );
+    cache->cache.setMaxCost( size );
+
+    // the layout caches of other threads are adjusted on their next access
+}
+
+int QskTextCache::cacheSize()
+{
+    return qskCacheSize;
+}
+
+void QskTextCache::clear()
+{
+    {
+        auto cache = qskSizeCache();
+
+        QMutexLocker locker( &cache->mutex );
+        cache->cache.clear();
+    }
+
+    qskLayoutCache.cache.clear();
+}
+
+QskTextCache::Statistics QskTextCache::statistics()
+{
+    Statistics statistics;
+    statistics.hits = qskHits;
+    statistics.misses = qskMisses;
+
+    return statistics;
+}
+
+void QskTextCache::resetStatistics()
+{
+    qskHits = 0;
+    qskMisses = 0;
+}
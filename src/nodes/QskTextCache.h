@@ -0,0 +1,119 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) The authors
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#ifndef QSK_TEXT_CACHE_H
+#define QSK_TEXT_CACHE_H
+
+#include "QskGlobal.h"
+#include "QskTextOptions.h"
+
+#include <qcolor.h>
+#include <qfont.h>
+#include <qglyphrun.h>
+#include <qlist.h>
+#include <qsize.h>
+#include <qstring.h>
+#include <qvector.h>
+
+/*
+    Calculating the size of a text and laying it out for the glyph nodes
+    are expensive operations, that often happen several times for the
+    same text: f.e. when calculating size hints for the layout
+    and for rendering the same text afterwards.
+
+    QskTextCache consists of bounded caches ( least recently used ):
+
+    - the sizes are plain values and are shared between all threads:
+      f.e. the size hints being calculated on the GUI thread or
+      being precalculated on worker threads ( see QskLayoutEngine2D ).
+
+    - the layouts contain QGlyphRun/QRawFont objects, that must not
+      be used/destroyed from other threads than the one, that has created
+      them. So each thread - usually the render thread - has its own cache.
+ */
+namespace QskTextCache
+{
+    class QSK_EXPORT Key
+    {
+      public:
+        enum Type : quint8
+        {
+            TextSize,
+            TextLayout
+        };
+
+        Key() = default;
+
+        // without any constraint
+        Key( Type, const QString&, const QFont&, const QskTextOptions& );
+
+        Key( Type, const QString&, const QFont&,
+            const QskTextOptions&, const QSizeF&, int alignment = 0 );
+
+        bool operator==( const Key& ) const noexcept;
+
+        QString text;
+        QFont font;
+        QskTextOptions options;
+        QSizeF size; // the width/height constraint
+        int alignment = 0;
+        Type type = TextSize;
+
+        // QSizeF() might also be passed as constraint
+        bool isConstrained = false;
+    };
+
+    QSK_EXPORT QskHashValue qHash( const Key&, QskHashValue seed = 0 ) noexcept;
+
+    // the text laid out for QSGGlyphNode
+    class Layout
+    {
+      public:
+        QList< QGlyphRun > glyphRuns;
+
+        /*
+            Rich text only: the explicit colors of the glyph runs
+            and the indexes of the runs, that belong to links.
+         */
+        QVector< QColor > runColors;
+        QVector< int > linkRuns;
+
+        qreal width = 0.0; // the widest line
+        qreal height = 0.0;
+        qreal boundingHeight = 0.0;
+    };
+
+    class Statistics
+    {
+      public:
+        inline qreal hitRate() const
+        {
+            const auto count = hits + misses;
+            return count ? qreal( hits ) / count : 0.0;
+        }
+
+        quint64 hits = 0;
+        quint64 misses = 0;
+    };
+
+    QSK_EXPORT bool findSize( const Key&, QSizeF& );
+    QSK_EXPORT void insertSize( const Key&, const QSizeF& );
+
+    // the layouts of the calling thread
+    QSK_EXPORT bool findLayout( const Key&, Layout& );
+    QSK_EXPORT void insertLayout( const Key&, const Layout& );
+
+    // maximum number of entries - for the sizes and for each layout cache
+    QSK_EXPORT void setCacheSize( int );
+    QSK_EXPORT int cacheSize();
+
+    // the sizes and the layouts of the calling thread
+    QSK_EXPORT void clear();
+
+    QSK_EXPORT Statistics statistics();
+    QSK_EXPORT void resetStatistics();
+}
+
+#endif
@@ -7,14 +7,14 @@
 #include "QskTextColors.h"
 #include "QskTextOptions.h"
 #include "QskTextRenderer.h"
+#include "QskPlainTextRenderer.h"
 
 #include <qfont.h>
 #include <qstring.h>
 
-static inline QskHashValue qskHash(
+static inline QskHashValue qskLayoutHash(
     const QString& text, const QSizeF& size, const QFont& font,
-    const QskTextOptions& options, const QskTextColors& colors,
-    Qt::Alignment alignment, Qsk::TextStyle textStyle )
+    const QskTextOptions& options, Qt::Alignment alignment )
 {
     QskHashValue hash = 11000;
 
@@ -22,15 +22,25 @@ static inline QskHashValue qskHash(
     hash = qHash( font, hash );
     hash = options.hash( hash );
     hash = qHash( alignment, hash );
+    hash = qHashBits( &size, sizeof( QSizeF ), hash );
+
+    return hash;
+}
+
+static inline QskHashValue qskColorsHash(
+    const QskTextColors& colors, Qsk::TextStyle textStyle )
+{
+    QskHashValue hash = 11000;
+
     hash = qHash( textStyle, hash );
     hash = colors.hash( hash );
-    hash = qHashBits( &size, sizeof( QSizeF ), hash );
 
     return hash;
 }
 
 QskTextNode::QskTextNode()
-    : m_hash( 0 )
+    : m_layoutHash( 0 )
+    , m_colorsHash( 0 )
 {
 }
 
@@ -52,21 +62,40 @@ void QskTextNode::setTextData(
     if ( matrix != this->matrix() ) // avoid setting DirtyMatrix accidently
         setMatrix( matrix );
 
-    const auto hash = qskHash( text, rect.size(), font,
-        options, colors, alignment, textStyle );
+    const auto layoutHash = qskLayoutHash(
+        text, rect.size(), font, options, alignment );
 
-    if ( hash != m_hash )
+    const auto colorsHash = qskColorsHash( colors, textStyle );
+
+    if ( layoutHash != m_layoutHash )
     {
-        m_hash = hash;
+        m_layoutHash = layoutHash;
+        m_colorsHash = colorsHash;
 
         const QRectF textRect( 0, 0, rect.width(), rect.height() );
 
-        /*
-            In case of having color changes only we would could
-            go a faster update path: see QskPlainTextRenderer::updateNodeColor.
-            TODO ...
-         */
         QskTextRenderer::updateNode( text, font, options, textStyle,
             colors, alignment, textRect, item, this );
     }
+    else if ( colorsHash != m_colorsHash )
+    {
+        m_colorsHash = colorsHash;
+
+        if ( options.effectiveFormat( text ) == QskTextOptions::PlainText )
+        {
+            /*
+                The glyphs are unchanged and we only need to
+                update the materials of the glyph nodes.
+             */
+            QskPlainTextRenderer::updateNodeColor( this,
+                colors.textColor(), textStyle, colors.styleColor() );
+        }
+        else
+        {
+            const QRectF textRect( 0, 0, rect.width(), rect.height() );
+
+            QskTextRenderer::updateNode( text, font, options, textStyle,
+                colors, alignment, textRect, item, this );
+        }
+    }
 }
@@ -29,7 +29,8 @@ class QSK_EXPORT QskTextNode : public QSGTransformNode
         Qt::Alignment, Qsk::TextStyle );
 
   private:
-    QskHashValue m_hash;
+    QskHashValue m_layoutHash;
+    QskHashValue m_colorsHash;
 };
 
 #endif
@@ -7,6 +7,7 @@
 #include "QskPlainTextRenderer.h"
 #include "QskRichTextRenderer.h"
 #include "QskTextOptions.h"
+#include "QskTextCache.h"
 
 #include <qrect.h>
 
@@ -17,20 +18,40 @@
 QSizeF QskTextRenderer::textSize(
     const QString& text, const QFont& font, const QskTextOptions& options )
 {
+    const QskTextCache::Key key( QskTextCache::Key::TextSize,
+        text, font, options );
+
+    QSizeF size;
+    if ( QskTextCache::findSize( key, size ) )
+        return size;
+
     if ( options.effectiveFormat( text ) == QskTextOptions::PlainText )
-        return QskPlainTextRenderer::textSize( text, font, options );
+        size = QskPlainTextRenderer::textSize( text, font, options );
     else
-        return QskRichTextRenderer::textSize( text, font, options );
+        size = QskRichTextRenderer::textSize( text, font, options );
+
+    QskTextCache::insertSize( key, size );
+    return size;
 }
 
 QSizeF QskTextRenderer::textSize(
     const QString& text, const QFont& font, const QskTextOptions& options,
-    const QSizeF& size )
+    const QSizeF& constraint )
 {
+    const QskTextCache::Key key( QskTextCache::Key::TextSize,
+        text, font, options, constraint );
+
+    QSizeF size;
+    if ( QskTextCache::findSize( key, size ) )
+        return size;
+
     if ( options.effectiveFormat( text ) == QskTextOptions::PlainText )
-        return QskPlainTextRenderer::textRect( text, font, options, size ).size();
+        size = QskPlainTextRenderer::textRect( text, font, options, constraint ).size();
     else
-        return QskRichTextRenderer::textRect( text, font, options, size ).size();
+        size = QskRichTextRenderer::textRect( text, font, options, constraint ).size();
+
+    QskTextCache::insertSize( key, size );
+    return size;
 }
 
 void QskTextRenderer::updateNode(
@@ -38,7 +59,7 @@ void QskTextRenderer::updateNode(
     Qsk::TextStyle style, const QskTextColors& colors, Qt::Alignment alignment,
     const QRectF& rect, const QQuickItem* item, QSGTransformNode* node )
 {
-    if ( options.format() == QskTextOptions::PlainText )
+    if ( options.effectiveFormat( text ) == QskTextOptions::PlainText )
     {
         QskPlainTextRenderer::updateNode(
             text, font, options, style, colors, alignment, rect, item, node );
@@ -0,0 +1,217 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) The authors
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#include "QskTriangulationCache.h"
+
+#include <qcache.h>
+#include <qmutex.h>
+#include <qglobalstatic.h>
+
+#include <cmath>
+
+namespace
+{
+    class Cache
+    {
+      public:
+        Cache()
+        {
+            // 4MB of float coordinates
+            cache.setMaxCost( 1 << 20 );
+        }
+
+        QCache< QskTriangulationCache::Key, QskTriangulationCache::Vertices > cache;
+        QMutex mutex;
+    };
+}
+
+Q_GLOBAL_STATIC( Cache, qskCache )
+
+static bool qskIsEqual( const QPainterPath& path1, const QPainterPath& path2 )
+{
+    // QPainterPath::operator== is fuzzy
+    if ( path1.fillRule() != path2.fillRule() )
+        return false;
+
+    const int count = path1.elementCount();
+    if ( count != path2.elementCount() )
+        return false;
+
+    for ( int i = 0; i < count; i++ )
+    {
+        const auto e1 = path1.elementAt( i );
+        const auto e2 = path2.elementAt( i );
+
+        if ( e1.type != e2.type || e1.x != e2.x || e1.y != e2.y )
+            return false;
+    }
+
+    return true;
+}
+
+static bool qskIsEqual( const QPen& pen1, const QPen& pen2 )
+{
+    // the same attributes as being used in penHash: the color is irrelevant
+
+    if ( pen1.style() != pen2.style() || pen1.widthF() != pen2.widthF()
+        || pen1.capStyle() != pen2.capStyle() || pen1.joinStyle() != pen2.joinStyle()
+        || pen1.miterLimit() != pen2.miterLimit() || pen1.isCosmetic() != pen2.isCosmetic() )
+    {
+        return false;
+    }
+
+    if ( pen1.style() != Qt::SolidLine )
+    {
+        if ( pen1.dashOffset() != pen2.dashOffset()
+            || pen1.dashPattern() != pen2.dashPattern() )
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+QskTriangulationCache::Key::Key(
+        const QPainterPath& path, const QTransform& transform )
+    : m_path( path )
+    , m_transform( transform )
+    , m_pen( Qt::NoPen )
+{
+    m_hash = transformHash( transform, 17219 );
+    m_hash = pathHash( path, m_hash );
+}
+
+QskTriangulationCache::Key::Key( const QPainterPath& path,
+        const QTransform& transform, const QPen& pen )
+    : m_path( path )
+    , m_transform( transform )
+    , m_pen( pen )
+{
+    m_hash = transformHash( transform, 17569 );
+    m_hash = penHash( pen, m_hash );
+    m_hash = pathHash( path, m_hash );
+}
+
+bool QskTriangulationCache::Key::operator==( const Key& other ) const
+{
+    return ( m_hash == other.m_hash )
+        && ( m_transform == other.m_transform )
+        && qskIsEqual( m_pen, other.m_pen )
+        && qskIsEqual( m_path, other.m_path );
+}
+
+QskHashValue QskTriangulationCache::pathHash(
+    const QPainterPath& path, QskHashValue seed )
+{
+    auto hash = qHash( static_cast< int >( path.fillRule() ), seed );
+
+    for ( int i = 0; i < path.elementCount(); i++ )
+    {
+        // QPainterPath::Element has padding bytes: no qHashBits
+        const auto element = path.elementAt( i );
+
+        hash = qHash( static_cast< int >( element.type ), hash );
+        hash = qHash( element.x, hash );
+        hash = qHash( element.y, hash );
+    }
+
+    return hash;
+}
+
+QskHashValue QskTriangulationCache::penHash( const QPen& pen, QskHashValue seed )
+{
+    auto hash = qHash( pen.widthF(), seed );
+
+    hash = qHash( static_cast< int >( pen.style() ), hash );
+    hash = qHash( static_cast< int >( pen.capStyle() ), hash );
+    hash = qHash( static_cast< int >( pen.joinStyle() ), hash );
+    hash = qHash( pen.miterLimit(), hash );
+    hash = qHash( pen.isCosmetic(), hash );
+
+    if ( pen.style() != Qt::SolidLine )
+    {
+        hash = qHash( pen.dashOffset(), hash );
+
+        const auto pattern = pen.dashPattern();
+        for ( const auto value : pattern )
+            hash = qHash( value, hash );
+    }
+
+    return hash;
+}
+
+QskHashValue QskTriangulationCache::transformHash(
+    const QTransform& transform, QskHashValue seed )
+{
+    // QTransform has internal flags: no qHashBits
+    const qreal values[] =
+    {
+        transform.m11(), transform.m12(), transform.m13(),
+        transform.m21(), transform.m22(), transform.m23(),
+        transform.m31(), transform.m32(), transform.m33()
+    };
+
+    return qHashBits( values, sizeof( values ), seed );
+}
+
+qreal QskTriangulationCache::scaleBucket( const QTransform& transform )
+{
+    const auto sx = std::hypot( transform.m11(), transform.m12() );
+    const auto sy = std::hypot( transform.m21(), transform.m22() );
+
+    const auto scale = qMax( sx, sy );
+    if ( !( scale > 0.0 ) || !std::isfinite( scale ) )
+        return 1.0;
+
+    return std::exp2( std::ceil( std::log2( scale ) ) );
+}
+
+bool QskTriangulationCache::find( const Key& key, Vertices& vertices )
+{
+    auto cache = qskCache();
+
+    QMutexLocker locker( &cache->mutex );
+
+    if ( const auto cachedVertices = cache->cache.object( key ) )
+    {
+        vertices = *cachedVertices; // implicitly shared
+        return true;
+    }
+
+    return false;
+}
+
+void QskTriangulationCache::insert( const Key& key, const Vertices& vertices )
+{
+    auto cache = qskCache();
+
+    QMutexLocker locker( &cache->mutex );
+    cache->cache.insert( key, new Vertices( vertices ), vertices.size() );
+}
+
+void QskTriangulationCache::setCacheSize( int size )
+{
+    auto cache = qskCache();
+
+    QMutexLocker locker( &cache->mutex );
+    cache->cache.setMaxCost( qMax( size, 0 ) );
+}
+
+int QskTriangulationCache::cacheSize()
+{
+    auto cache = qskCache();
+
+    QMutexLocker locker( &cache->mutex );
+    return static_cast< int >( cache->cache.maxCost() );
+}
+
+void QskTriangulationCache::clear()
+{
+    auto cache = qskCache();
+
+    QMutexLocker locker( &cache->mutex );
+    cache->cache.clear();
+}
@@ -0,0 +1,87 @@
+/******************************************************************************
+ * QSkinny - Copyright (C) The authors
+ *           SPDX-License-Identifier: BSD-3-Clause
+ *****************************************************************************/
+
+#ifndef QSK_TRIANGULATION_CACHE_H
+#define QSK_TRIANGULATION_CACHE_H
+
+#include "QskGlobal.h"
+
+#include <qpainterpath.h>
+#include <qpen.h>
+#include <qtransform.h>
+#include <qvector.h>
+
+/*
+    Triangulating/stroking a path is expensive and the results
+    often end up being identical: f.e when the same icon/shape is displayed
+    many times or when only the position or the color of it is changing.
+
+    The cache stores the vertices of the triangles ( x1, y1, x2, y2, ... )
+    untransformed or scaled by a power of 2. Transforming them
+    while copying them into the geometry is cheap compared to
+    redoing the triangulation.
+
+    The remaining transformation is applied on the CPU and not in
+    a vertex shader, as the materials of QskFillNode are shared
+    with all other fill nodes.
+ */
+namespace QskTriangulationCache
+{
+    using Vertices = QVector< float >;
+
+    QskHashValue pathHash( const QPainterPath&, QskHashValue seed = 0 );
+    QskHashValue penHash( const QPen&, QskHashValue seed = 0 );
+    QskHashValue transformHash( const QTransform&, QskHashValue seed = 0 );
+
+    /*
+        A power of 2, that is >= the scale factor of the transformation.
+        Triangulating at this resolution is precise enough for all scale
+        factors in [ bucket / 2, bucket ] and avoids cache misses, when
+        the scale factor is animated.
+     */
+    qreal scaleBucket( const QTransform& );
+
+    /*
+        The hash is only used for finding the entry. As a collision would
+        result in rendering the triangles of another shape, the path,
+        the pen and the transformation are stored and compared on a hit.
+     */
+    class Key
+    {
+      public:
+        // triangulating the fill area of a path
+        Key( const QPainterPath&, const QTransform& );
+
+        // stroking a path
+        Key( const QPainterPath&, const QTransform&, const QPen& );
+
+        bool operator==( const Key& ) const;
+
+        inline QskHashValue hash() const { return m_hash; }
+
+      private:
+        QPainterPath m_path;
+        QTransform m_transform;
+        QPen m_pen;
+
+        QskHashValue m_hash;
+    };
+
+    inline QskHashValue qHash( const Key& key, QskHashValue seed = 0 )
+    {
+        return key.hash() ^ seed;
+    }
+
+    bool find( const Key&, Vertices& );
+    void insert( const Key&, const Vertices& );
+
+    // max number of cached coordinates
+    void setCacheSize( int );
+    int cacheSize();
+
+    void clear();
+}
+
+#endif
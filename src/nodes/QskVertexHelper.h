@@ -9,6 +9,7 @@
 #include "QskGradient.h"
 #include "QskGradientDirection.h"
 #include "QskVertex.h"
+#include "QskTessellation.h"
 
 #include <qmath.h>
 
@@ -97,10 +98,9 @@ namespace QskVertex
 
         inline void operator++() { increment(); }
 
-        static int segmentHint( qreal radius )
+        static int segmentHint( qreal radius, qreal devicePixelRatio = 1.0 )
         {
-            const auto arcLength = radius * M_PI_2;
-            return qBound( 3, qCeil( arcLength / 3.0 ), 18 ); // every 3 pixels
+            return QskTessellation::arcSegmentCount( radius, M_PI_2, devicePixelRatio );
         }
 
         inline void revert()
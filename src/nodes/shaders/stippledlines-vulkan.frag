@@ -0,0 +1,34 @@
+#version 440
+
+layout( location = 0 ) in float linePos;
+layout( location = 0 ) out vec4 fragColor;
+
+layout( std140, binding = 0 ) uniform buf
+{
+    mat4 matrix;
+    vec4 color;
+    vec2 origin;
+    float dashOffset;
+    float dashPeriod;
+    vec4 dashes[2];
+} ubuf;
+
+void main()
+{
+    float pos = mod( linePos + ubuf.dashOffset, ubuf.dashPeriod );
+
+    // dashes[] are the end positions of dash, gap, dash, gap ...
+
+    for ( int i = 0; i < 8; i++ )
+    {
+        if ( pos < ubuf.dashes[ i / 4 ][ i % 4 ] )
+        {
+            if ( i % 2 == 1 )
+                discard;
+
+            break;
+        }
+    }
+
+    fragColor = ubuf.color;
+}
@@ -0,0 +1,43 @@
+uniform lowp vec4 color;
+
+uniform highp float dashOffset;
+uniform highp float dashPeriod;
+uniform highp vec4 dashes[2];
+
+varying highp float linePos;
+
+// dashes[] are the end positions of dash, gap, dash, gap ...
+
+bool isGap( highp float pos )
+{
+    if ( pos < dashes[0].x )
+        return false;
+
+    if ( pos < dashes[0].y )
+        return true;
+
+    if ( pos < dashes[0].z )
+        return false;
+
+    if ( pos < dashes[0].w )
+        return true;
+
+    if ( pos < dashes[1].x )
+        return false;
+
+    if ( pos < dashes[1].y )
+        return true;
+
+    if ( pos < dashes[1].z )
+        return false;
+
+    return true;
+}
+
+void main()
+{
+    if ( isGap( mod( linePos + dashOffset, dashPeriod ) ) )
+        discard;
+
+    gl_FragColor = color;
+}
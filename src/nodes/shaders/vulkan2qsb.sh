@@ -23,3 +23,6 @@ qsbcompile gradientlinear-vulkan.frag
 
 qsbcompile crisplines-vulkan.vert
 qsbcompile crisplines-vulkan.frag
+
+qsbcompile stippledlines-vulkan.vert
+qsbcompile stippledlines-vulkan.frag